@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aio_cpp.dir/aio.cpp.o"
+  "CMakeFiles/aio_cpp.dir/aio.cpp.o.d"
+  "aio_cpp"
+  "aio_cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/aio_cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/i2c_cpp.dir/i2c.cpp.o"
+  "CMakeFiles/i2c_cpp.dir/i2c.cpp.o.d"
+  "i2c_cpp"
+  "i2c_cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/i2c_cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
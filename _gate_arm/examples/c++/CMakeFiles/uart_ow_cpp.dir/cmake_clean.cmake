@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uart_ow_cpp.dir/uart_ow.cpp.o"
+  "CMakeFiles/uart_ow_cpp.dir/uart_ow.cpp.o.d"
+  "uart_ow_cpp"
+  "uart_ow_cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uart_ow_cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
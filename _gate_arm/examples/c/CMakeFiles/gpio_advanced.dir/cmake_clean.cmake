@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gpio_advanced.dir/gpio_advanced.c.o"
+  "CMakeFiles/gpio_advanced.dir/gpio_advanced.c.o.d"
+  "gpio_advanced"
+  "gpio_advanced.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/gpio_advanced.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
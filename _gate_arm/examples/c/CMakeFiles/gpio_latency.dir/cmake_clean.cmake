@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gpio_latency.dir/gpio_latency.c.o"
+  "CMakeFiles/gpio_latency.dir/gpio_latency.c.o.d"
+  "gpio_latency"
+  "gpio_latency.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/gpio_latency.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
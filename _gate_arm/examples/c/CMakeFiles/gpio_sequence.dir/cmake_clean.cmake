@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gpio_sequence.dir/gpio_sequence.c.o"
+  "CMakeFiles/gpio_sequence.dir/gpio_sequence.c.o.d"
+  "gpio_sequence"
+  "gpio_sequence.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/gpio_sequence.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hellomraa.dir/hellomraa.c.o"
+  "CMakeFiles/hellomraa.dir/hellomraa.c.o.d"
+  "hellomraa"
+  "hellomraa.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hellomraa.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/i2c_hmc5883l.dir/i2c_hmc5883l.c.o"
+  "CMakeFiles/i2c_hmc5883l.dir/i2c_hmc5883l.c.o.d"
+  "i2c_hmc5883l"
+  "i2c_hmc5883l.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/i2c_hmc5883l.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
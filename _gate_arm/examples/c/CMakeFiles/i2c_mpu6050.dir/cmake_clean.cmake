@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/i2c_mpu6050.dir/i2c_mpu6050.c.o"
+  "CMakeFiles/i2c_mpu6050.dir/i2c_mpu6050.c.o.d"
+  "i2c_mpu6050"
+  "i2c_mpu6050.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/i2c_mpu6050.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iio.dir/iio.c.o"
+  "CMakeFiles/iio.dir/iio.c.o.d"
+  "iio"
+  "iio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
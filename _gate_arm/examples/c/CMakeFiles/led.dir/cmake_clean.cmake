@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/led.dir/led.c.o"
+  "CMakeFiles/led.dir/led.c.o.d"
+  "led"
+  "led.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/led.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
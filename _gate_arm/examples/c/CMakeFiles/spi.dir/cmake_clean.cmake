@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/spi.dir/spi.c.o"
+  "CMakeFiles/spi.dir/spi.c.o.d"
+  "spi"
+  "spi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/spi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
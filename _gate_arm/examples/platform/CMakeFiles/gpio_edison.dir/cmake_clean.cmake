@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gpio_edison.dir/gpio_edison.c.o"
+  "CMakeFiles/gpio_edison.dir/gpio_edison.c.o.d"
+  "gpio_edison"
+  "gpio_edison.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/gpio_edison.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mraa-gpio.dir/mraa-gpio.c.o"
+  "CMakeFiles/mraa-gpio.dir/mraa-gpio.c.o.d"
+  "mraa-gpio"
+  "mraa-gpio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mraa-gpio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mraa-i2c.dir/mraa-i2c.c.o"
+  "CMakeFiles/mraa-i2c.dir/mraa-i2c.c.o.d"
+  "mraa-i2c"
+  "mraa-i2c.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mraa-i2c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
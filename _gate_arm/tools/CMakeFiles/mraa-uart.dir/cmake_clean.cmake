@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mraa-uart.dir/mraa-uart.c.o"
+  "CMakeFiles/mraa-uart.dir/mraa-uart.c.o.d"
+  "mraa-uart"
+  "mraa-uart.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mraa-uart.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
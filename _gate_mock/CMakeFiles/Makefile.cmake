@@ -0,0 +1,161 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/GTest/GTestConfig.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestConfigVersion.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets-release.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets.cmake"
+  "/root/repo/.git/HEAD"
+  "/root/repo/.git/refs/heads/master"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/git-data/grabRef.cmake"
+  "/root/repo/cmake/modules/FindJSON-C.cmake"
+  "/root/repo/cmake/modules/GetGitRevisionDescription.cmake"
+  "/root/repo/cmake/modules/GetGitRevisionDescription.cmake.in"
+  "/root/repo/cmake/modules/OpenCVDetectPython.cmake"
+  "/root/repo/cmake/modules/version.c.in"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/c++/CMakeLists.txt"
+  "/root/repo/examples/c/CMakeLists.txt"
+  "/root/repo/examples/platform/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/grovepi/CMakeLists.txt"
+  "/root/repo/src/mock/CMakeLists.txt"
+  "/root/repo/src/mraa.pc.cmake"
+  "/root/repo/src/uart_ow/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/unit/CMakeLists.txt"
+  "/root/repo/tests/unit/api/api_common_h_unit.cxx"
+  "/root/repo/tests/unit/api/api_common_hpp_unit.cxx"
+  "/root/repo/tests/unit/api/mraa_gpio_multi_unit.cxx"
+  "/root/repo/tests/unit/api/mraa_i2c_poller_unit.cxx"
+  "/root/repo/tests/unit/api/mraa_i2c_queue_unit.cxx"
+  "/root/repo/tests/unit/api/mraa_initio_h_unit.cxx"
+  "/root/repo/tests/unit/api/mraa_initio_hpp_unit.cxx"
+  "/root/repo/tests/unit/gpio/gpio_counter_unit.cxx"
+  "/root/repo/tests/unit/gpio/gpio_debounce_unit.cxx"
+  "/root/repo/tests/unit/gpio/gpio_event_ring_unit.cxx"
+  "/root/repo/tests/unit/gpio/gpio_mux_unit.cxx"
+  "/root/repo/tests/unit/gpio/gpio_recorder_unit.cxx"
+  "/root/repo/tools/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/git-data/HEAD"
+  "CMakeFiles/git-data/grabRef.cmake"
+  "CMakeFiles/git-data/head-ref"
+  "src/version.c"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/mraa.pc"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/grovepi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/uart_ow/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/mock/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/c/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/platform/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/c++/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/CMakeFiles/mraa.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/aio.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/gpio.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/gpio_advanced.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/gpio_latency.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/gpio_sequence.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/hellomraa.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/i2c_hmc5883l.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/i2c_mpu6050.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/led.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/pwm.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/spi.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/uart.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/uart_advanced.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/iio.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/uart_ow.dir/DependInfo.cmake"
+  "examples/platform/CMakeFiles/gpio_edison.dir/DependInfo.cmake"
+  "examples/platform/CMakeFiles/up2-leds.dir/DependInfo.cmake"
+  "examples/c++/CMakeFiles/aio_cpp.dir/DependInfo.cmake"
+  "examples/c++/CMakeFiles/gpio_advanced_cpp.dir/DependInfo.cmake"
+  "examples/c++/CMakeFiles/gpio_cpp.dir/DependInfo.cmake"
+  "examples/c++/CMakeFiles/pwm_cpp.dir/DependInfo.cmake"
+  "examples/c++/CMakeFiles/i2c_cpp.dir/DependInfo.cmake"
+  "examples/c++/CMakeFiles/spi_cpp.dir/DependInfo.cmake"
+  "examples/c++/CMakeFiles/uart_cpp.dir/DependInfo.cmake"
+  "examples/c++/CMakeFiles/iio_cpp.dir/DependInfo.cmake"
+  "examples/c++/CMakeFiles/led_cpp.dir/DependInfo.cmake"
+  "examples/c++/CMakeFiles/uart_ow_cpp.dir/DependInfo.cmake"
+  "tests/unit/CMakeFiles/test_unit_common_h.dir/DependInfo.cmake"
+  "tests/unit/CMakeFiles/test_unit_common_hpp.dir/DependInfo.cmake"
+  "tests/unit/CMakeFiles/test_unit_gpio_event_ring.dir/DependInfo.cmake"
+  "tests/unit/CMakeFiles/test_unit_gpio_counter.dir/DependInfo.cmake"
+  "tests/unit/CMakeFiles/test_unit_gpio_recorder.dir/DependInfo.cmake"
+  "tests/unit/CMakeFiles/test_unit_gpio_debounce.dir/DependInfo.cmake"
+  "tests/unit/CMakeFiles/test_unit_gpio_mux.dir/DependInfo.cmake"
+  "tests/unit/CMakeFiles/test_unit_ioinit_h.dir/DependInfo.cmake"
+  "tests/unit/CMakeFiles/test_unit_ioinit_hpp.dir/DependInfo.cmake"
+  "tests/unit/CMakeFiles/test_unit_gpio_multi.dir/DependInfo.cmake"
+  "tests/unit/CMakeFiles/test_unit_i2c_queue.dir/DependInfo.cmake"
+  "tests/unit/CMakeFiles/test_unit_i2c_poller.dir/DependInfo.cmake"
+  "tests/unit/CMakeFiles/test_unit_all.dir/DependInfo.cmake"
+  "tools/CMakeFiles/mraa-gpio.dir/DependInfo.cmake"
+  "tools/CMakeFiles/mraa-i2c.dir/DependInfo.cmake"
+  "tools/CMakeFiles/mraa-uart.dir/DependInfo.cmake"
+  )
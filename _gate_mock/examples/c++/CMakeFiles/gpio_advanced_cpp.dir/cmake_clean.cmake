@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gpio_advanced_cpp.dir/gpio_advanced.cpp.o"
+  "CMakeFiles/gpio_advanced_cpp.dir/gpio_advanced.cpp.o.d"
+  "gpio_advanced_cpp"
+  "gpio_advanced_cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gpio_advanced_cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gpio_cpp.dir/gpio.cpp.o"
+  "CMakeFiles/gpio_cpp.dir/gpio.cpp.o.d"
+  "gpio_cpp"
+  "gpio_cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gpio_cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iio_cpp.dir/iio.cpp.o"
+  "CMakeFiles/iio_cpp.dir/iio.cpp.o.d"
+  "iio_cpp"
+  "iio_cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iio_cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
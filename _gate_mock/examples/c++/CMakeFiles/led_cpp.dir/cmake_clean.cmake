@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/led_cpp.dir/led.cpp.o"
+  "CMakeFiles/led_cpp.dir/led.cpp.o.d"
+  "led_cpp"
+  "led_cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/led_cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
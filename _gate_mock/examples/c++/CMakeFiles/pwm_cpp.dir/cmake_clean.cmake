@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pwm_cpp.dir/pwm.cpp.o"
+  "CMakeFiles/pwm_cpp.dir/pwm.cpp.o.d"
+  "pwm_cpp"
+  "pwm_cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pwm_cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
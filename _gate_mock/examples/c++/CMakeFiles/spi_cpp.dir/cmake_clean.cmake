@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/spi_cpp.dir/spi.cpp.o"
+  "CMakeFiles/spi_cpp.dir/spi.cpp.o.d"
+  "spi_cpp"
+  "spi_cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/spi_cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
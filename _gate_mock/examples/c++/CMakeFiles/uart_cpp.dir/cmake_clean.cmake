@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uart_cpp.dir/uart.cpp.o"
+  "CMakeFiles/uart_cpp.dir/uart.cpp.o.d"
+  "uart_cpp"
+  "uart_cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uart_cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
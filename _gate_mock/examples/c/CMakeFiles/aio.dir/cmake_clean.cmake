@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aio.dir/aio.c.o"
+  "CMakeFiles/aio.dir/aio.c.o.d"
+  "aio"
+  "aio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/aio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gpio.dir/gpio.c.o"
+  "CMakeFiles/gpio.dir/gpio.c.o.d"
+  "gpio"
+  "gpio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/gpio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
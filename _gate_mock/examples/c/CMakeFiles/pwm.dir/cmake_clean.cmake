@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pwm.dir/pwm.c.o"
+  "CMakeFiles/pwm.dir/pwm.c.o.d"
+  "pwm"
+  "pwm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pwm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uart.dir/uart.c.o"
+  "CMakeFiles/uart.dir/uart.c.o.d"
+  "uart"
+  "uart.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/uart.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
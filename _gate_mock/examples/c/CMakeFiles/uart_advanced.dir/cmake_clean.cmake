@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uart_advanced.dir/uart_advanced.c.o"
+  "CMakeFiles/uart_advanced.dir/uart_advanced.c.o.d"
+  "uart_advanced"
+  "uart_advanced.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/uart_advanced.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
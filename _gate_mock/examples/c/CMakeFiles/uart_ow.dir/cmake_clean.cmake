@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uart_ow.dir/uart_ow.c.o"
+  "CMakeFiles/uart_ow.dir/uart_ow.c.o.d"
+  "uart_ow"
+  "uart_ow.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/uart_ow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/up2-leds.dir/up2-leds.cpp.o"
+  "CMakeFiles/up2-leds.dir/up2-leds.cpp.o.d"
+  "up2-leds"
+  "up2-leds.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/up2-leds.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
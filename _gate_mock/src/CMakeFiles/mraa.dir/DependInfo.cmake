@@ -0,0 +1,60 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/aio/aio.c" "src/CMakeFiles/mraa.dir/aio/aio.c.o" "gcc" "src/CMakeFiles/mraa.dir/aio/aio.c.o.d"
+  "/root/repo/src/gpio/gpio.c" "src/CMakeFiles/mraa.dir/gpio/gpio.c.o" "gcc" "src/CMakeFiles/mraa.dir/gpio/gpio.c.o.d"
+  "/root/repo/src/gpio/gpio_chardev.c" "src/CMakeFiles/mraa.dir/gpio/gpio_chardev.c.o" "gcc" "src/CMakeFiles/mraa.dir/gpio/gpio_chardev.c.o.d"
+  "/root/repo/src/gpio/gpio_counter.c" "src/CMakeFiles/mraa.dir/gpio/gpio_counter.c.o" "gcc" "src/CMakeFiles/mraa.dir/gpio/gpio_counter.c.o.d"
+  "/root/repo/src/gpio/gpio_debounce.c" "src/CMakeFiles/mraa.dir/gpio/gpio_debounce.c.o" "gcc" "src/CMakeFiles/mraa.dir/gpio/gpio_debounce.c.o.d"
+  "/root/repo/src/gpio/gpio_dispatcher.c" "src/CMakeFiles/mraa.dir/gpio/gpio_dispatcher.c.o" "gcc" "src/CMakeFiles/mraa.dir/gpio/gpio_dispatcher.c.o.d"
+  "/root/repo/src/gpio/gpio_event_ring.c" "src/CMakeFiles/mraa.dir/gpio/gpio_event_ring.c.o" "gcc" "src/CMakeFiles/mraa.dir/gpio/gpio_event_ring.c.o.d"
+  "/root/repo/src/gpio/gpio_mmap.c" "src/CMakeFiles/mraa.dir/gpio/gpio_mmap.c.o" "gcc" "src/CMakeFiles/mraa.dir/gpio/gpio_mmap.c.o.d"
+  "/root/repo/src/gpio/gpio_mux.c" "src/CMakeFiles/mraa.dir/gpio/gpio_mux.c.o" "gcc" "src/CMakeFiles/mraa.dir/gpio/gpio_mux.c.o.d"
+  "/root/repo/src/gpio/gpio_recorder.c" "src/CMakeFiles/mraa.dir/gpio/gpio_recorder.c.o" "gcc" "src/CMakeFiles/mraa.dir/gpio/gpio_recorder.c.o.d"
+  "/root/repo/src/gpio/gpio_registry.c" "src/CMakeFiles/mraa.dir/gpio/gpio_registry.c.o" "gcc" "src/CMakeFiles/mraa.dir/gpio/gpio_registry.c.o.d"
+  "/root/repo/src/gpio/gpio_sequencer.c" "src/CMakeFiles/mraa.dir/gpio/gpio_sequencer.c.o" "gcc" "src/CMakeFiles/mraa.dir/gpio/gpio_sequencer.c.o.d"
+  "/root/repo/src/gpio/gpio_shadow.c" "src/CMakeFiles/mraa.dir/gpio/gpio_shadow.c.o" "gcc" "src/CMakeFiles/mraa.dir/gpio/gpio_shadow.c.o.d"
+  "/root/repo/src/gpio/gpio_snapshot.c" "src/CMakeFiles/mraa.dir/gpio/gpio_snapshot.c.o" "gcc" "src/CMakeFiles/mraa.dir/gpio/gpio_snapshot.c.o.d"
+  "/root/repo/src/grovepi/grovepi.c" "src/CMakeFiles/mraa.dir/grovepi/grovepi.c.o" "gcc" "src/CMakeFiles/mraa.dir/grovepi/grovepi.c.o.d"
+  "/root/repo/src/i2c/i2c.c" "src/CMakeFiles/mraa.dir/i2c/i2c.c.o" "gcc" "src/CMakeFiles/mraa.dir/i2c/i2c.c.o.d"
+  "/root/repo/src/i2c/i2c_bus.c" "src/CMakeFiles/mraa.dir/i2c/i2c_bus.c.o" "gcc" "src/CMakeFiles/mraa.dir/i2c/i2c_bus.c.o.d"
+  "/root/repo/src/i2c/i2c_poller.c" "src/CMakeFiles/mraa.dir/i2c/i2c_poller.c.o" "gcc" "src/CMakeFiles/mraa.dir/i2c/i2c_poller.c.o.d"
+  "/root/repo/src/i2c/i2c_queue.c" "src/CMakeFiles/mraa.dir/i2c/i2c_queue.c.o" "gcc" "src/CMakeFiles/mraa.dir/i2c/i2c_queue.c.o.d"
+  "/root/repo/src/iio/iio.c" "src/CMakeFiles/mraa.dir/iio/iio.c.o" "gcc" "src/CMakeFiles/mraa.dir/iio/iio.c.o.d"
+  "/root/repo/src/initio/initio.c" "src/CMakeFiles/mraa.dir/initio/initio.c.o" "gcc" "src/CMakeFiles/mraa.dir/initio/initio.c.o.d"
+  "/root/repo/src/led/led.c" "src/CMakeFiles/mraa.dir/led/led.c.o" "gcc" "src/CMakeFiles/mraa.dir/led/led.c.o.d"
+  "/root/repo/src/mock/mock.c" "src/CMakeFiles/mraa.dir/mock/mock.c.o" "gcc" "src/CMakeFiles/mraa.dir/mock/mock.c.o.d"
+  "/root/repo/src/mock/mock_board.c" "src/CMakeFiles/mraa.dir/mock/mock_board.c.o" "gcc" "src/CMakeFiles/mraa.dir/mock/mock_board.c.o.d"
+  "/root/repo/src/mock/mock_board_aio.c" "src/CMakeFiles/mraa.dir/mock/mock_board_aio.c.o" "gcc" "src/CMakeFiles/mraa.dir/mock/mock_board_aio.c.o.d"
+  "/root/repo/src/mock/mock_board_gpio.c" "src/CMakeFiles/mraa.dir/mock/mock_board_gpio.c.o" "gcc" "src/CMakeFiles/mraa.dir/mock/mock_board_gpio.c.o.d"
+  "/root/repo/src/mock/mock_board_i2c.c" "src/CMakeFiles/mraa.dir/mock/mock_board_i2c.c.o" "gcc" "src/CMakeFiles/mraa.dir/mock/mock_board_i2c.c.o.d"
+  "/root/repo/src/mock/mock_board_spi.c" "src/CMakeFiles/mraa.dir/mock/mock_board_spi.c.o" "gcc" "src/CMakeFiles/mraa.dir/mock/mock_board_spi.c.o.d"
+  "/root/repo/src/mock/mock_board_uart.c" "src/CMakeFiles/mraa.dir/mock/mock_board_uart.c.o" "gcc" "src/CMakeFiles/mraa.dir/mock/mock_board_uart.c.o.d"
+  "/root/repo/src/mraa.c" "src/CMakeFiles/mraa.dir/mraa.c.o" "gcc" "src/CMakeFiles/mraa.dir/mraa.c.o.d"
+  "/root/repo/src/pwm/pwm.c" "src/CMakeFiles/mraa.dir/pwm/pwm.c.o" "gcc" "src/CMakeFiles/mraa.dir/pwm/pwm.c.o.d"
+  "/root/repo/src/spi/spi.c" "src/CMakeFiles/mraa.dir/spi/spi.c.o" "gcc" "src/CMakeFiles/mraa.dir/spi/spi.c.o.d"
+  "/root/repo/src/uart/uart.c" "src/CMakeFiles/mraa.dir/uart/uart.c.o" "gcc" "src/CMakeFiles/mraa.dir/uart/uart.c.o.d"
+  "/root/repo/src/uart_ow/uart_ow.c" "src/CMakeFiles/mraa.dir/uart_ow/uart_ow.c.o" "gcc" "src/CMakeFiles/mraa.dir/uart_ow/uart_ow.c.o.d"
+  "/root/repo/_gate_mock/src/version.c" "src/CMakeFiles/mraa.dir/version.c.o" "gcc" "src/CMakeFiles/mraa.dir/version.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_mock/src/libmraa.so" "/root/repo/_gate_mock/src/libmraa.so.2.2.0"
+  "/root/repo/_gate_mock/src/libmraa.so.2" "/root/repo/_gate_mock/src/libmraa.so.2.2.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,81 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mraa.dir/aio/aio.c.o"
+  "CMakeFiles/mraa.dir/aio/aio.c.o.d"
+  "CMakeFiles/mraa.dir/gpio/gpio.c.o"
+  "CMakeFiles/mraa.dir/gpio/gpio.c.o.d"
+  "CMakeFiles/mraa.dir/gpio/gpio_chardev.c.o"
+  "CMakeFiles/mraa.dir/gpio/gpio_chardev.c.o.d"
+  "CMakeFiles/mraa.dir/gpio/gpio_counter.c.o"
+  "CMakeFiles/mraa.dir/gpio/gpio_counter.c.o.d"
+  "CMakeFiles/mraa.dir/gpio/gpio_debounce.c.o"
+  "CMakeFiles/mraa.dir/gpio/gpio_debounce.c.o.d"
+  "CMakeFiles/mraa.dir/gpio/gpio_dispatcher.c.o"
+  "CMakeFiles/mraa.dir/gpio/gpio_dispatcher.c.o.d"
+  "CMakeFiles/mraa.dir/gpio/gpio_event_ring.c.o"
+  "CMakeFiles/mraa.dir/gpio/gpio_event_ring.c.o.d"
+  "CMakeFiles/mraa.dir/gpio/gpio_mmap.c.o"
+  "CMakeFiles/mraa.dir/gpio/gpio_mmap.c.o.d"
+  "CMakeFiles/mraa.dir/gpio/gpio_mux.c.o"
+  "CMakeFiles/mraa.dir/gpio/gpio_mux.c.o.d"
+  "CMakeFiles/mraa.dir/gpio/gpio_recorder.c.o"
+  "CMakeFiles/mraa.dir/gpio/gpio_recorder.c.o.d"
+  "CMakeFiles/mraa.dir/gpio/gpio_registry.c.o"
+  "CMakeFiles/mraa.dir/gpio/gpio_registry.c.o.d"
+  "CMakeFiles/mraa.dir/gpio/gpio_sequencer.c.o"
+  "CMakeFiles/mraa.dir/gpio/gpio_sequencer.c.o.d"
+  "CMakeFiles/mraa.dir/gpio/gpio_shadow.c.o"
+  "CMakeFiles/mraa.dir/gpio/gpio_shadow.c.o.d"
+  "CMakeFiles/mraa.dir/gpio/gpio_snapshot.c.o"
+  "CMakeFiles/mraa.dir/gpio/gpio_snapshot.c.o.d"
+  "CMakeFiles/mraa.dir/grovepi/grovepi.c.o"
+  "CMakeFiles/mraa.dir/grovepi/grovepi.c.o.d"
+  "CMakeFiles/mraa.dir/i2c/i2c.c.o"
+  "CMakeFiles/mraa.dir/i2c/i2c.c.o.d"
+  "CMakeFiles/mraa.dir/i2c/i2c_bus.c.o"
+  "CMakeFiles/mraa.dir/i2c/i2c_bus.c.o.d"
+  "CMakeFiles/mraa.dir/i2c/i2c_poller.c.o"
+  "CMakeFiles/mraa.dir/i2c/i2c_poller.c.o.d"
+  "CMakeFiles/mraa.dir/i2c/i2c_queue.c.o"
+  "CMakeFiles/mraa.dir/i2c/i2c_queue.c.o.d"
+  "CMakeFiles/mraa.dir/iio/iio.c.o"
+  "CMakeFiles/mraa.dir/iio/iio.c.o.d"
+  "CMakeFiles/mraa.dir/initio/initio.c.o"
+  "CMakeFiles/mraa.dir/initio/initio.c.o.d"
+  "CMakeFiles/mraa.dir/led/led.c.o"
+  "CMakeFiles/mraa.dir/led/led.c.o.d"
+  "CMakeFiles/mraa.dir/mock/mock.c.o"
+  "CMakeFiles/mraa.dir/mock/mock.c.o.d"
+  "CMakeFiles/mraa.dir/mock/mock_board.c.o"
+  "CMakeFiles/mraa.dir/mock/mock_board.c.o.d"
+  "CMakeFiles/mraa.dir/mock/mock_board_aio.c.o"
+  "CMakeFiles/mraa.dir/mock/mock_board_aio.c.o.d"
+  "CMakeFiles/mraa.dir/mock/mock_board_gpio.c.o"
+  "CMakeFiles/mraa.dir/mock/mock_board_gpio.c.o.d"
+  "CMakeFiles/mraa.dir/mock/mock_board_i2c.c.o"
+  "CMakeFiles/mraa.dir/mock/mock_board_i2c.c.o.d"
+  "CMakeFiles/mraa.dir/mock/mock_board_spi.c.o"
+  "CMakeFiles/mraa.dir/mock/mock_board_spi.c.o.d"
+  "CMakeFiles/mraa.dir/mock/mock_board_uart.c.o"
+  "CMakeFiles/mraa.dir/mock/mock_board_uart.c.o.d"
+  "CMakeFiles/mraa.dir/mraa.c.o"
+  "CMakeFiles/mraa.dir/mraa.c.o.d"
+  "CMakeFiles/mraa.dir/pwm/pwm.c.o"
+  "CMakeFiles/mraa.dir/pwm/pwm.c.o.d"
+  "CMakeFiles/mraa.dir/spi/spi.c.o"
+  "CMakeFiles/mraa.dir/spi/spi.c.o.d"
+  "CMakeFiles/mraa.dir/uart/uart.c.o"
+  "CMakeFiles/mraa.dir/uart/uart.c.o.d"
+  "CMakeFiles/mraa.dir/uart_ow/uart_ow.c.o"
+  "CMakeFiles/mraa.dir/uart_ow/uart_ow.c.o.d"
+  "CMakeFiles/mraa.dir/version.c.o"
+  "CMakeFiles/mraa.dir/version.c.o.d"
+  "libmraa.pdb"
+  "libmraa.so"
+  "libmraa.so.2"
+  "libmraa.so.2.2.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mraa.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+// Auto-Generated file
+#include "version.h"
+
+const char* gVERSION = "v2.2.0";
+const char* gVERSION_SHORT = "2.2.0";
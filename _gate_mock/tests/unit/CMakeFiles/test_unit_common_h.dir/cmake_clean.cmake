@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unit_common_h.dir/api/api_common_h_unit.cxx.o"
+  "CMakeFiles/test_unit_common_h.dir/api/api_common_h_unit.cxx.o.d"
+  "test_unit_common_h"
+  "test_unit_common_h.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unit_common_h.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unit_common_hpp.dir/api/api_common_hpp_unit.cxx.o"
+  "CMakeFiles/test_unit_common_hpp.dir/api/api_common_hpp_unit.cxx.o.d"
+  "test_unit_common_hpp"
+  "test_unit_common_hpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unit_common_hpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
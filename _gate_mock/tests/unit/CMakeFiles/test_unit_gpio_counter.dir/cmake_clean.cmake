@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unit_gpio_counter.dir/gpio/gpio_counter_unit.cxx.o"
+  "CMakeFiles/test_unit_gpio_counter.dir/gpio/gpio_counter_unit.cxx.o.d"
+  "test_unit_gpio_counter"
+  "test_unit_gpio_counter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unit_gpio_counter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unit_gpio_debounce.dir/gpio/gpio_debounce_unit.cxx.o"
+  "CMakeFiles/test_unit_gpio_debounce.dir/gpio/gpio_debounce_unit.cxx.o.d"
+  "test_unit_gpio_debounce"
+  "test_unit_gpio_debounce.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unit_gpio_debounce.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unit_gpio_event_ring.dir/gpio/gpio_event_ring_unit.cxx.o"
+  "CMakeFiles/test_unit_gpio_event_ring.dir/gpio/gpio_event_ring_unit.cxx.o.d"
+  "test_unit_gpio_event_ring"
+  "test_unit_gpio_event_ring.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unit_gpio_event_ring.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
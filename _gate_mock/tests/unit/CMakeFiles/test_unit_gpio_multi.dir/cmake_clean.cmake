@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unit_gpio_multi.dir/api/mraa_gpio_multi_unit.cxx.o"
+  "CMakeFiles/test_unit_gpio_multi.dir/api/mraa_gpio_multi_unit.cxx.o.d"
+  "test_unit_gpio_multi"
+  "test_unit_gpio_multi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unit_gpio_multi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unit_gpio_mux.dir/gpio/gpio_mux_unit.cxx.o"
+  "CMakeFiles/test_unit_gpio_mux.dir/gpio/gpio_mux_unit.cxx.o.d"
+  "test_unit_gpio_mux"
+  "test_unit_gpio_mux.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unit_gpio_mux.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
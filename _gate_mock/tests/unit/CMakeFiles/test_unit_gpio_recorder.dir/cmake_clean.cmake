@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unit_gpio_recorder.dir/gpio/gpio_recorder_unit.cxx.o"
+  "CMakeFiles/test_unit_gpio_recorder.dir/gpio/gpio_recorder_unit.cxx.o.d"
+  "test_unit_gpio_recorder"
+  "test_unit_gpio_recorder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unit_gpio_recorder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unit_i2c_poller.dir/api/mraa_i2c_poller_unit.cxx.o"
+  "CMakeFiles/test_unit_i2c_poller.dir/api/mraa_i2c_poller_unit.cxx.o.d"
+  "test_unit_i2c_poller"
+  "test_unit_i2c_poller.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unit_i2c_poller.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unit_i2c_queue.dir/api/mraa_i2c_queue_unit.cxx.o"
+  "CMakeFiles/test_unit_i2c_queue.dir/api/mraa_i2c_queue_unit.cxx.o.d"
+  "test_unit_i2c_queue"
+  "test_unit_i2c_queue.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unit_i2c_queue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
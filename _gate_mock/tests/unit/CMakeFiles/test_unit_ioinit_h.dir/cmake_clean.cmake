@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unit_ioinit_h.dir/api/mraa_initio_h_unit.cxx.o"
+  "CMakeFiles/test_unit_ioinit_h.dir/api/mraa_initio_h_unit.cxx.o.d"
+  "test_unit_ioinit_h"
+  "test_unit_ioinit_h.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unit_ioinit_h.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unit_ioinit_hpp.dir/api/mraa_initio_hpp_unit.cxx.o"
+  "CMakeFiles/test_unit_ioinit_hpp.dir/api/mraa_initio_hpp_unit.cxx.o.d"
+  "test_unit_ioinit_hpp"
+  "test_unit_ioinit_hpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unit_ioinit_hpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
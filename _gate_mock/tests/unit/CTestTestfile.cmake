@@ -0,0 +1,116 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit
+# Build directory: /root/repo/_gate_mock/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(api_common_h_unit.test_libmraa_init_doa "/root/repo/_gate_mock/tests/unit/test_unit_common_h" "--gtest_filter=api_common_h_unit.test_libmraa_init_doa")
+set_tests_properties(api_common_h_unit.test_libmraa_init_doa PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;20;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(api_common_h_unit.test_libmraa_init_deinit "/root/repo/_gate_mock/tests/unit/test_unit_common_h" "--gtest_filter=api_common_h_unit.test_libmraa_init_deinit")
+set_tests_properties(api_common_h_unit.test_libmraa_init_deinit PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;20;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(api_common_h_unit.test_libmraa_common_methods "/root/repo/_gate_mock/tests/unit/test_unit_common_h" "--gtest_filter=api_common_h_unit.test_libmraa_common_methods")
+set_tests_properties(api_common_h_unit.test_libmraa_common_methods PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;20;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(api_common_hpp_unit.test_libmraa_common_methods "/root/repo/_gate_mock/tests/unit/test_unit_common_hpp" "--gtest_filter=api_common_hpp_unit.test_libmraa_common_methods")
+set_tests_properties(api_common_hpp_unit.test_libmraa_common_methods PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;27;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_event_ring_unit.test_size_power_of_two "/root/repo/_gate_mock/tests/unit/test_unit_gpio_event_ring" "--gtest_filter=gpio_event_ring_unit.test_size_power_of_two")
+set_tests_properties(gpio_event_ring_unit.test_size_power_of_two PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;35;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_event_ring_unit.test_empty "/root/repo/_gate_mock/tests/unit/test_unit_gpio_event_ring" "--gtest_filter=gpio_event_ring_unit.test_empty")
+set_tests_properties(gpio_event_ring_unit.test_empty PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;35;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_event_ring_unit.test_full_drops_newest "/root/repo/_gate_mock/tests/unit/test_unit_gpio_event_ring" "--gtest_filter=gpio_event_ring_unit.test_full_drops_newest")
+set_tests_properties(gpio_event_ring_unit.test_full_drops_newest PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;35;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_event_ring_unit.test_wraparound "/root/repo/_gate_mock/tests/unit/test_unit_gpio_event_ring" "--gtest_filter=gpio_event_ring_unit.test_wraparound")
+set_tests_properties(gpio_event_ring_unit.test_wraparound PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;35;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_event_ring_unit.test_wait_notified "/root/repo/_gate_mock/tests/unit/test_unit_gpio_event_ring" "--gtest_filter=gpio_event_ring_unit.test_wait_notified")
+set_tests_properties(gpio_event_ring_unit.test_wait_notified PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;35;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_event_ring_unit.test_close_wakes_readers "/root/repo/_gate_mock/tests/unit/test_unit_gpio_event_ring" "--gtest_filter=gpio_event_ring_unit.test_close_wakes_readers")
+set_tests_properties(gpio_event_ring_unit.test_close_wakes_readers PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;35;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_event_ring_unit.test_concurrent_consumers "/root/repo/_gate_mock/tests/unit/test_unit_gpio_event_ring" "--gtest_filter=gpio_event_ring_unit.test_concurrent_consumers")
+set_tests_properties(gpio_event_ring_unit.test_concurrent_consumers PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;35;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_counter_unit.test_zero_elapsed "/root/repo/_gate_mock/tests/unit/test_unit_gpio_counter" "--gtest_filter=gpio_counter_unit.test_zero_elapsed")
+set_tests_properties(gpio_counter_unit.test_zero_elapsed PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;42;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_counter_unit.test_rate_since_start "/root/repo/_gate_mock/tests/unit/test_unit_gpio_counter" "--gtest_filter=gpio_counter_unit.test_rate_since_start")
+set_tests_properties(gpio_counter_unit.test_rate_since_start PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;42;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_counter_unit.test_rate_sliding_window "/root/repo/_gate_mock/tests/unit/test_unit_gpio_counter" "--gtest_filter=gpio_counter_unit.test_rate_sliding_window")
+set_tests_properties(gpio_counter_unit.test_rate_sliding_window PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;42;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_counter_unit.test_bucket_wrap "/root/repo/_gate_mock/tests/unit/test_unit_gpio_counter" "--gtest_filter=gpio_counter_unit.test_bucket_wrap")
+set_tests_properties(gpio_counter_unit.test_bucket_wrap PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;42;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_counter_unit.test_counter_wrap "/root/repo/_gate_mock/tests/unit/test_unit_gpio_counter" "--gtest_filter=gpio_counter_unit.test_counter_wrap")
+set_tests_properties(gpio_counter_unit.test_counter_wrap PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;42;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_counter_unit.test_clear_and_invalid_line "/root/repo/_gate_mock/tests/unit/test_unit_gpio_counter" "--gtest_filter=gpio_counter_unit.test_clear_and_invalid_line")
+set_tests_properties(gpio_counter_unit.test_clear_and_invalid_line PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;42;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_recorder_unit.test_encode_layout "/root/repo/_gate_mock/tests/unit/test_unit_gpio_recorder" "--gtest_filter=gpio_recorder_unit.test_encode_layout")
+set_tests_properties(gpio_recorder_unit.test_encode_layout PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;49;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_recorder_unit.test_round_trip "/root/repo/_gate_mock/tests/unit/test_unit_gpio_recorder" "--gtest_filter=gpio_recorder_unit.test_round_trip")
+set_tests_properties(gpio_recorder_unit.test_round_trip PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;49;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_recorder_unit.test_decode_malformed "/root/repo/_gate_mock/tests/unit/test_unit_gpio_recorder" "--gtest_filter=gpio_recorder_unit.test_decode_malformed")
+set_tests_properties(gpio_recorder_unit.test_decode_malformed PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;49;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_recorder_unit.test_overwrite_folds_tail "/root/repo/_gate_mock/tests/unit/test_unit_gpio_recorder" "--gtest_filter=gpio_recorder_unit.test_overwrite_folds_tail")
+set_tests_properties(gpio_recorder_unit.test_overwrite_folds_tail PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;49;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_recorder_unit.test_vcd "/root/repo/_gate_mock/tests/unit/test_unit_gpio_recorder" "--gtest_filter=gpio_recorder_unit.test_vcd")
+set_tests_properties(gpio_recorder_unit.test_vcd PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;49;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_recorder_unit.test_vcd_invalid "/root/repo/_gate_mock/tests/unit/test_unit_gpio_recorder" "--gtest_filter=gpio_recorder_unit.test_vcd_invalid")
+set_tests_properties(gpio_recorder_unit.test_vcd_invalid PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;49;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_debounce_unit.test_stable_edge "/root/repo/_gate_mock/tests/unit/test_unit_gpio_debounce" "--gtest_filter=gpio_debounce_unit.test_stable_edge")
+set_tests_properties(gpio_debounce_unit.test_stable_edge PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;57;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_debounce_unit.test_bounce_restarts_window "/root/repo/_gate_mock/tests/unit/test_unit_gpio_debounce" "--gtest_filter=gpio_debounce_unit.test_bounce_restarts_window")
+set_tests_properties(gpio_debounce_unit.test_bounce_restarts_window PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;57;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_debounce_unit.test_lines_independent "/root/repo/_gate_mock/tests/unit/test_unit_gpio_debounce" "--gtest_filter=gpio_debounce_unit.test_lines_independent")
+set_tests_properties(gpio_debounce_unit.test_lines_independent PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;57;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_debounce_unit.test_commit_suppresses_repeats "/root/repo/_gate_mock/tests/unit/test_unit_gpio_debounce" "--gtest_filter=gpio_debounce_unit.test_commit_suppresses_repeats")
+set_tests_properties(gpio_debounce_unit.test_commit_suppresses_repeats PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;57;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_mux_unit.test_dedup "/root/repo/_gate_mock/tests/unit/test_unit_gpio_mux" "--gtest_filter=gpio_mux_unit.test_dedup")
+set_tests_properties(gpio_mux_unit.test_dedup PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;64;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_mux_unit.test_merge_out "/root/repo/_gate_mock/tests/unit/test_unit_gpio_mux" "--gtest_filter=gpio_mux_unit.test_merge_out")
+set_tests_properties(gpio_mux_unit.test_merge_out PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;64;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_mux_unit.test_merge_out_only "/root/repo/_gate_mock/tests/unit/test_unit_gpio_mux" "--gtest_filter=gpio_mux_unit.test_merge_out_only")
+set_tests_properties(gpio_mux_unit.test_merge_out_only PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;64;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_mux_unit.test_skip_dropped "/root/repo/_gate_mock/tests/unit/test_unit_gpio_mux" "--gtest_filter=gpio_mux_unit.test_skip_dropped")
+set_tests_properties(gpio_mux_unit.test_skip_dropped PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;64;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_mux_unit.test_ops "/root/repo/_gate_mock/tests/unit/test_unit_gpio_mux" "--gtest_filter=gpio_mux_unit.test_ops")
+set_tests_properties(gpio_mux_unit.test_ops PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;64;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(gpio_mux_unit.test_cache "/root/repo/_gate_mock/tests/unit/test_unit_gpio_mux" "--gtest_filter=gpio_mux_unit.test_cache")
+set_tests_properties(gpio_mux_unit.test_cache PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;64;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_initio_h_unit.test_aio_init_invalid "/root/repo/_gate_mock/tests/unit/test_unit_ioinit_h" "--gtest_filter=mraa_initio_h_unit.test_aio_init_invalid")
+set_tests_properties(mraa_initio_h_unit.test_aio_init_invalid PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;83;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_initio_h_unit.test_aio_init_valid "/root/repo/_gate_mock/tests/unit/test_unit_ioinit_h" "--gtest_filter=mraa_initio_h_unit.test_aio_init_valid")
+set_tests_properties(mraa_initio_h_unit.test_aio_init_valid PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;83;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_initio_h_unit.test_gpio_init_invalid "/root/repo/_gate_mock/tests/unit/test_unit_ioinit_h" "--gtest_filter=mraa_initio_h_unit.test_gpio_init_invalid")
+set_tests_properties(mraa_initio_h_unit.test_gpio_init_invalid PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;83;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_initio_h_unit.test_gpio_init_valid "/root/repo/_gate_mock/tests/unit/test_unit_ioinit_h" "--gtest_filter=mraa_initio_h_unit.test_gpio_init_valid")
+set_tests_properties(mraa_initio_h_unit.test_gpio_init_valid PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;83;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_initio_h_unit.test_i2c_init "/root/repo/_gate_mock/tests/unit/test_unit_ioinit_h" "--gtest_filter=mraa_initio_h_unit.test_i2c_init")
+set_tests_properties(mraa_initio_h_unit.test_i2c_init PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;83;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_initio_h_unit.test_iio_init "/root/repo/_gate_mock/tests/unit/test_unit_ioinit_h" "--gtest_filter=mraa_initio_h_unit.test_iio_init")
+set_tests_properties(mraa_initio_h_unit.test_iio_init PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;83;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_initio_h_unit.test_pwm_init "/root/repo/_gate_mock/tests/unit/test_unit_ioinit_h" "--gtest_filter=mraa_initio_h_unit.test_pwm_init")
+set_tests_properties(mraa_initio_h_unit.test_pwm_init PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;83;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_initio_h_unit.test_spi_init "/root/repo/_gate_mock/tests/unit/test_unit_ioinit_h" "--gtest_filter=mraa_initio_h_unit.test_spi_init")
+set_tests_properties(mraa_initio_h_unit.test_spi_init PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;83;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_initio_h_unit.test_uart_init "/root/repo/_gate_mock/tests/unit/test_unit_ioinit_h" "--gtest_filter=mraa_initio_h_unit.test_uart_init")
+set_tests_properties(mraa_initio_h_unit.test_uart_init PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;83;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_initio_h_unit.test_uart_ow_init "/root/repo/_gate_mock/tests/unit/test_unit_ioinit_h" "--gtest_filter=mraa_initio_h_unit.test_uart_ow_init")
+set_tests_properties(mraa_initio_h_unit.test_uart_ow_init PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;83;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_initio_h_unit.test_multiple_init "/root/repo/_gate_mock/tests/unit/test_unit_ioinit_h" "--gtest_filter=mraa_initio_h_unit.test_multiple_init")
+set_tests_properties(mraa_initio_h_unit.test_multiple_init PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;83;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_initio_h_unit.test_leftover_string "/root/repo/_gate_mock/tests/unit/test_unit_ioinit_h" "--gtest_filter=mraa_initio_h_unit.test_leftover_string")
+set_tests_properties(mraa_initio_h_unit.test_leftover_string PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;83;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_initio_hpp_unit.test_aio_init_invalid "/root/repo/_gate_mock/tests/unit/test_unit_ioinit_hpp" "--gtest_filter=mraa_initio_hpp_unit.test_aio_init_invalid")
+set_tests_properties(mraa_initio_hpp_unit.test_aio_init_invalid PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;89;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_initio_hpp_unit.test_aio_init_valid "/root/repo/_gate_mock/tests/unit/test_unit_ioinit_hpp" "--gtest_filter=mraa_initio_hpp_unit.test_aio_init_valid")
+set_tests_properties(mraa_initio_hpp_unit.test_aio_init_valid PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;89;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_gpio_multi_unit.test_write_multi "/root/repo/_gate_mock/tests/unit/test_unit_gpio_multi" "--gtest_filter=mraa_gpio_multi_unit.test_write_multi")
+set_tests_properties(mraa_gpio_multi_unit.test_write_multi PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;98;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_gpio_multi_unit.test_write_mask "/root/repo/_gate_mock/tests/unit/test_unit_gpio_multi" "--gtest_filter=mraa_gpio_multi_unit.test_write_mask")
+set_tests_properties(mraa_gpio_multi_unit.test_write_mask PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;98;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_gpio_multi_unit.test_write_mask_beyond_pins "/root/repo/_gate_mock/tests/unit/test_unit_gpio_multi" "--gtest_filter=mraa_gpio_multi_unit.test_write_mask_beyond_pins")
+set_tests_properties(mraa_gpio_multi_unit.test_write_mask_beyond_pins PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;98;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_i2c_queue_unit.test_priority_order "/root/repo/_gate_mock/tests/unit/test_unit_i2c_queue" "--gtest_filter=mraa_i2c_queue_unit.test_priority_order")
+set_tests_properties(mraa_i2c_queue_unit.test_priority_order PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;104;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_i2c_queue_unit.test_wait_jobs "/root/repo/_gate_mock/tests/unit/test_unit_i2c_queue" "--gtest_filter=mraa_i2c_queue_unit.test_wait_jobs")
+set_tests_properties(mraa_i2c_queue_unit.test_wait_jobs PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;104;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_i2c_queue_unit.test_refused_from_callback "/root/repo/_gate_mock/tests/unit/test_unit_i2c_queue" "--gtest_filter=mraa_i2c_queue_unit.test_refused_from_callback")
+set_tests_properties(mraa_i2c_queue_unit.test_refused_from_callback PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;104;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_i2c_poller_unit.test_merge_blocks "/root/repo/_gate_mock/tests/unit/test_unit_i2c_poller" "--gtest_filter=mraa_i2c_poller_unit.test_merge_blocks")
+set_tests_properties(mraa_i2c_poller_unit.test_merge_blocks PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;112;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
+add_test(mraa_i2c_poller_unit.test_failing_device "/root/repo/_gate_mock/tests/unit/test_unit_i2c_poller" "--gtest_filter=mraa_i2c_poller_unit.test_failing_device")
+set_tests_properties(mraa_i2c_poller_unit.test_failing_device PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/unit/CMakeLists.txt;112;gtest_add_tests;/root/repo/tests/unit/CMakeLists.txt;0;")
@@ -118,6 +118,82 @@ typedef struct {
 
 typedef mraa_gpio_event* mraa_gpio_events_t;
 
+/**
+ * Gpio edge capture record
+ */
+typedef struct {
+    int pin; /**< pin number provided at init */
+    mraa_gpio_edge_t edge; /**< MRAA_GPIO_EDGE_RISING or MRAA_GPIO_EDGE_FALLING */
+    mraa_timestamp_t timestamp; /**< CLOCK_MONOTONIC time of the edge in ns */
+    unsigned int seqno; /**< sequence number of the edge across the context's lines */
+    unsigned int line_seqno; /**< sequence number of the edge on this line */
+} mraa_gpio_capture_event;
+
+/**
+ * Opaque pointer definition to a compiled gpio sequence
+ */
+typedef struct _gpio_sequence* mraa_gpio_sequence;
+
+/**
+ * Gpio sequence step, bit i of mask and values is pin i of the context
+ */
+typedef struct {
+    uint64_t mask; /**< pins driven by this step */
+    uint64_t values; /**< levels of the driven pins */
+    unsigned int delay_ns; /**< time from this step to the next one */
+} mraa_gpio_seq_step;
+
+/**
+ * Timing achieved by a gpio sequence run. Lateness is the time between the
+ * deadline of a step and the moment its write was issued.
+ */
+typedef struct {
+    unsigned int steps; /**< steps executed */
+    unsigned long long duration_ns; /**< first deadline to end of the last delay */
+    unsigned long long late_mean_ns; /**< mean lateness */
+    unsigned long long late_max_ns; /**< worst lateness */
+    unsigned int overruns; /**< steps whose write ended after the next deadline */
+} mraa_gpio_seq_stats;
+
+/**
+ * Gpio edge counter of one pin
+ */
+typedef struct {
+    uint64_t count; /**< edges since mraa_gpio_counter_start() or the last reset */
+    double frequency_hz; /**< edges per second over the sliding window */
+} mraa_gpio_counter_value;
+
+/**
+ * Magic at the start of a file written by mraa_gpio_record_start()
+ */
+#define MRAA_GPIO_RECORD_MAGIC "MRAAEDG1"
+
+/**
+ * Header of a file written by mraa_gpio_record_start(). The ring of records
+ * starts at data_offset and holds capacity bytes. Each record is one edge,
+ * stored as an unsigned LEB128 varint of (zigzag(delta_ns) << 7) | (idx << 1)
+ * | level, at most 11 bytes, where delta_ns is the time since the previous
+ * record, idx the index of the pin in pins and level the level after the edge. The records between
+ * tail and head, taken modulo capacity, are valid; the first one is relative
+ * to tail_timestamp and tail_levels are the pin levels just before it.
+ */
+typedef struct {
+    char magic[8]; /**< MRAA_GPIO_RECORD_MAGIC, not NUL terminated */
+    uint32_t version; /**< 1 */
+    uint32_t data_offset; /**< offset of the ring in the file */
+    uint64_t capacity; /**< size of the ring in bytes */
+    uint64_t head; /**< bytes written since the start */
+    uint64_t tail; /**< first byte not yet overwritten, counted like head */
+    mraa_timestamp_t tail_timestamp; /**< CLOCK_MONOTONIC ns the first record is relative to */
+    uint64_t tail_levels; /**< levels before the first record, bit i is pins[i] */
+    uint64_t events; /**< edges recorded */
+    uint64_t overwritten; /**< edges lost when the ring wrapped */
+    uint64_t dropped; /**< edges the kernel dropped before they were read */
+    uint32_t num_pins;
+    uint32_t reserved;
+    int32_t pins[64]; /**< pin numbers given at init */
+} mraa_gpio_record_header;
+
 /**
  * Initialise gpio_context, based on board number
  *
@@ -161,18 +237,116 @@ mraa_gpio_context mraa_gpio_init_raw(int gpiopin);
  */
 mraa_result_t mraa_gpio_edge_mode(mraa_gpio_context dev, mraa_gpio_edge_t mode);
 
+/**
+ * Filter the edges reported by mraa_gpio_isr(), must be called before it.
+ * A level is only reported once it held for stable_us, so contact bounce
+ * collapses into one edge and shorter glitches are dropped. On chardev
+ * platforms the kernel debounces the lines when it can, otherwise edges go
+ * through a software filter and the interrupt callback only runs for edges
+ * that passed it. The reported timestamp is that of the last edge before the
+ * level settled.
+ *
+ * @param dev The Gpio context
+ * @param stable_us Time a level must hold before it is reported, 0 turns
+ * filtering off
+ * @param vote When above 1, the line is read this many times once the level
+ * held and the majority is reported; must be odd, always filtered in software
+ * @return Result of operation
+ */
+mraa_result_t mraa_gpio_debounce(mraa_gpio_context dev, unsigned int stable_us, unsigned int vote);
+
 /**
  * Set an interrupt on pin(s).
  *
  * @param dev The Gpio context
  * @param edge The edge mode to set the gpio(s) into
  * @param fptr Function pointer to function to be called when interrupt is
- * triggered
+ * triggered, can be NULL if events are only consumed with mraa_gpio_read_events()
  * @param args Arguments passed to the interrupt handler (fptr)
  * @return Result of operation
  */
 mraa_result_t mraa_gpio_isr(mraa_gpio_context dev, mraa_gpio_edge_t edge, void (*fptr)(void*), void* args);
 
+/**
+ * Count edges on pin(s) in the interrupt handler, without a callback per
+ * edge. Each pin keeps a 64 bit edge count and an edges per second estimate
+ * over a sliding window of window_ms, readable from any thread with
+ * mraa_gpio_counter_read(). This takes the place of mraa_gpio_isr() on the
+ * context until mraa_gpio_counter_stop(); mraa_gpio_debounce() still applies.
+ *
+ * @param dev The Gpio context
+ * @param edge The edges to count
+ * @param window_ms Length of the frequency window, 0 for one second
+ * @return Result of operation, MRAA_ERROR_FEATURE_NOT_SUPPORTED on platforms
+ * handling interrupts themselves
+ */
+mraa_result_t mraa_gpio_counter_start(mraa_gpio_context dev, mraa_gpio_edge_t edge, unsigned int window_ms);
+
+/**
+ * Read the counter of one pin. Never blocks the interrupt handler.
+ *
+ * @param dev The Gpio context
+ * @param idx Index of the pin in the array given to mraa_gpio_init_multi(),
+ * 0 for a single pin context
+ * @param value Count and frequency of the pin
+ * @return Result of operation
+ */
+mraa_result_t mraa_gpio_counter_read(mraa_gpio_context dev, unsigned int idx, mraa_gpio_counter_value* value);
+
+/**
+ * Zero the counts and restart the frequency windows of every pin.
+ *
+ * @param dev The Gpio context
+ * @return Result of operation
+ */
+mraa_result_t mraa_gpio_counter_reset(mraa_gpio_context dev);
+
+/**
+ * Stop counting edges and release the interrupt.
+ *
+ * @param dev The Gpio context
+ * @return Result of operation
+ */
+mraa_result_t mraa_gpio_counter_stop(mraa_gpio_context dev);
+
+/**
+ * Record edges on pin(s) to a file, like a logic analyser. The file holds a
+ * ring of delta encoded records (see mraa_gpio_record_header) and is mapped
+ * in memory, the interrupt handler appends to it without a system call or an
+ * allocation per edge and the oldest edges are overwritten once the ring is
+ * full. This takes the place of mraa_gpio_isr() on the context until
+ * mraa_gpio_record_stop(); mraa_gpio_debounce() still applies. The file is
+ * only consistent once recording stopped.
+ *
+ * @param dev The Gpio context, at most 64 pins
+ * @param path File to create, truncated if it exists
+ * @param size Size of the ring in bytes
+ * @param edge The edges to record
+ * @return Result of operation, MRAA_ERROR_FEATURE_NOT_SUPPORTED on platforms
+ * handling interrupts themselves
+ */
+mraa_result_t mraa_gpio_record_start(mraa_gpio_context dev, const char* path, size_t size, mraa_gpio_edge_t edge);
+
+/**
+ * Stop recording, release the interrupt and flush the file.
+ *
+ * @param dev The Gpio context
+ * @param header Copy of the final file header, may be NULL
+ * @return Result of operation
+ */
+mraa_result_t mraa_gpio_record_stop(mraa_gpio_context dev, mraa_gpio_record_header* header);
+
+/**
+ * Print a file written by mraa_gpio_record_start() as a Value Change Dump,
+ * one wire per pin, time in ns from the first record kept in the ring.
+ *
+ * @param path File written by mraa_gpio_record_start()
+ * @param out Stream the VCD is written to
+ * @return Result of operation, MRAA_ERROR_INVALID_RESOURCE if path is not a
+ * valid recording
+ */
+mraa_result_t mraa_gpio_record_vcd(const char* path, FILE* out);
+
 /**
  * Get an array of structures describing triggered events.
  *
@@ -183,6 +357,74 @@ mraa_result_t mraa_gpio_isr(mraa_gpio_context dev, mraa_gpio_edge_t edge, void (
  */
 mraa_gpio_events_t mraa_gpio_get_events(mraa_gpio_context dev);
 
+/**
+ * Drain the events queued since mraa_gpio_isr() was called. Every edge the
+ * kernel reports is queued, in order, so bursts between two wakeups of the
+ * interrupt thread are not merged. The queue holds 1024 events, newer events
+ * are dropped while it is full.
+ *
+ * @param dev The Gpio context
+ * @param buf Array receiving the events, the id member is the pin number
+ * provided at init and the timestamp is CLOCK_MONOTONIC in ns
+ * @param max Length of buf
+ * @param timeout_ms How long to wait when no event is queued, 0 returns
+ * immediately and -1 waits forever
+ * @return Number of events written to buf, 0 on timeout or -1 on error
+ */
+int mraa_gpio_read_events(mraa_gpio_context dev, mraa_gpio_event* buf, unsigned int max, int timeout_ms);
+
+/**
+ * Drain the edges queued since mraa_gpio_isr() was called as capture records.
+ * On chardev platforms the timestamp and sequence numbers come from the
+ * kernel, taken in the interrupt handler. On sysfs the timestamp is taken when
+ * the interrupt thread wakes up, the edge is derived from the pin level read
+ * at that time and the sequence numbers are counted by mraa. Several threads
+ * may read one context, each record is returned to only one of them.
+ *
+ * @param dev The Gpio context
+ * @param buf Array receiving the records
+ * @param max Length of buf
+ * @param timeout_ms How long to wait when no edge is queued, 0 returns
+ * immediately and -1 waits forever
+ * @return Number of records written to buf, 0 on timeout or -1 on error,
+ * including mraa_gpio_close() being called on dev while waiting
+ */
+int mraa_gpio_capture_read(mraa_gpio_context dev, mraa_gpio_capture_event* buf, unsigned int max, int timeout_ms);
+
+/**
+ * Number of edges lost since mraa_gpio_isr() was called, either because the
+ * queue was full or, on chardev platforms, because the kernel event buffer
+ * overflowed (detected from gaps in the kernel sequence numbers).
+ *
+ * @param dev The Gpio context
+ * @return Number of lost edges
+ */
+unsigned int mraa_gpio_capture_dropped(mraa_gpio_context dev);
+
+/**
+ * Serve the interrupts of every context subsequently passed to mraa_gpio_isr()
+ * from a shared pool of worker threads, instead of one thread per context.
+ * Each worker owns an epoll set and contexts are spread evenly across the
+ * workers, a context always stays on the same worker. Callbacks of the Python
+ * and Java bindings keep their own thread.
+ *
+ * @param num_workers Number of worker threads, at least 1
+ * @param cpu_mask CPUs the workers may run on, one bit per CPU, 0 leaves the
+ * affinity untouched
+ * @param priority SCHED_FIFO priority of the workers, see mraa_set_priority(),
+ * 0 keeps the default scheduler
+ * @return Result of operation
+ */
+mraa_result_t mraa_gpio_dispatcher_start(unsigned int num_workers, uint64_t cpu_mask, int priority);
+
+/**
+ * Stop the shared interrupt dispatcher. Fails while contexts still have an
+ * interrupt registered on it, call mraa_gpio_isr_exit() on them first.
+ *
+ * @return Result of operation
+ */
+mraa_result_t mraa_gpio_dispatcher_stop();
+
 /**
  * Stop the current interrupt watcher on this Gpio, and set the Gpio edge mode
  * to MRAA_GPIO_EDGE_NONE(only for sysfs interface).
@@ -248,6 +490,24 @@ int mraa_gpio_read(mraa_gpio_context dev);
  */
 mraa_result_t mraa_gpio_read_multi(mraa_gpio_context dev, int output_values[]);
 
+/**
+ * Read the levels of all pins of the context as one bit mask, bit i being the
+ * i-th pin given to mraa_gpio_init_multi(), each with the CLOCK_MONOTONIC time
+ * in nanoseconds at which it was sampled. On chardev every gpiochip is read
+ * with a single request and the pins of a chip share its timestamp, taken in
+ * the middle of the read. With parallel set the chips are read at the same
+ * time from helper threads, which narrows the skew between chips when some
+ * sit behind slow I2C/SPI expanders; the threads are kept until the context
+ * is closed. The sysfs fallback reads pin by pin and ignores parallel.
+ *
+ * @param dev The Gpio context, at most 64 pins
+ * @param values Bit mask of the levels
+ * @param timestamps Array of one timestamp per pin, may be NULL
+ * @param parallel Read the chips concurrently
+ * @return Result of operation
+ */
+mraa_result_t mraa_gpio_snapshot(mraa_gpio_context dev, uint64_t* values, mraa_timestamp_t timestamps[], mraa_boolean_t parallel);
+
 /**
  * Write to the Gpio Value.
  *
@@ -268,6 +528,55 @@ mraa_result_t mraa_gpio_write(mraa_gpio_context dev, int value);
  */
 mraa_result_t mraa_gpio_write_multi(mraa_gpio_context dev, int input_values[]);
 
+/**
+ * Write to a subset of the Gpio(s) using packed bitmasks. Bit i of values and
+ * mask refers to the i-th pin provided to mraa_gpio_init_multi(), pins whose
+ * mask bit is cleared keep their current value. Only the first 64 pins of a
+ * context can be addressed. On chardev platforms this issues a single ioctl
+ * per gpio chip and never allocates memory.
+ *
+ * @param dev The Gpio context
+ * @param values Packed values to write, one bit per pin
+ * @param mask Packed selection of the pins to write, one bit per pin
+ * @return Result of operation
+ */
+mraa_result_t mraa_gpio_write_mask(mraa_gpio_context dev, uint64_t values, uint64_t mask);
+
+/**
+ * Compile a list of timed steps for a context, usually one obtained with
+ * mraa_gpio_init_multi() and set to output. On contexts using the memory
+ * mapped backend the register stores of every step are resolved here so
+ * running the sequence is just stores and a busy wait, other contexts go
+ * through mraa_gpio_write_mask(), as do all steps once mmap was enabled or
+ * disabled after compiling. The context must outlive the sequence.
+ *
+ * @param dev The Gpio context
+ * @param steps Steps to execute in order
+ * @param num_steps Number of steps
+ * @return compiled sequence or NULL
+ */
+mraa_gpio_sequence mraa_gpio_sequence_new(mraa_gpio_context dev, const mraa_gpio_seq_step steps[], unsigned int num_steps);
+
+/**
+ * Run a compiled sequence on a dedicated thread and wait for it to finish.
+ * Deadlines are absolute on CLOCK_MONOTONIC and the thread busy waits
+ * between steps, so a late step does not shift the following ones.
+ *
+ * @param seq The compiled sequence
+ * @param repeat Number of times the whole sequence is executed, at least 1
+ * @param priority SCHED_FIFO priority of the thread, 0 keeps the default scheduler
+ * @param stats Filled with the achieved timing, may be NULL
+ * @return Result of operation
+ */
+mraa_result_t mraa_gpio_sequence_run(mraa_gpio_sequence seq, unsigned int repeat, int priority, mraa_gpio_seq_stats* stats);
+
+/**
+ * Free a compiled sequence
+ *
+ * @param seq The compiled sequence
+ */
+void mraa_gpio_sequence_free(mraa_gpio_sequence seq);
+
 /**
  * Change ownership of the context.
  *
@@ -279,7 +588,9 @@ mraa_result_t mraa_gpio_owner(mraa_gpio_context dev, mraa_boolean_t owner);
 
 /**
  * Enable using memory mapped io instead of sysfs, chardev based I/O can be
- * considered memorymapped
+ * considered memorymapped. On boards describing their gpio registers, multi
+ * pin contexts are grouped by register bank so mraa_gpio_write_multi() and
+ * mraa_gpio_write_mask() update each bank with one set and one clear store.
  *
  * @deprecated
  * @param dev The Gpio context
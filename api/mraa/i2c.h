@@ -54,6 +54,72 @@ extern "C" {
  */
 typedef struct _i2c* mraa_i2c_context;
 
+/**
+ * Flags of an i2c message
+ */
+typedef enum {
+    MRAA_I2C_MSG_READ = 0x0001,    /**< Read into buf, the message writes buf otherwise */
+    MRAA_I2C_MSG_NOSTART = 0x4000, /**< Continue the previous message without a repeated start */
+} mraa_i2c_msg_flag_t;
+
+/**
+ * One segment of a combined i2c transaction
+ */
+typedef struct {
+    uint16_t addr;  /**< 7-bit address of the slave */
+    uint16_t flags; /**< Or of mraa_i2c_msg_flag_t */
+    uint16_t len;   /**< Number of bytes to transfer */
+    uint8_t* buf;   /**< Bytes to write or buffer to read into */
+} mraa_i2c_msg;
+
+/**
+ * Transaction run asynchronously by mraa_i2c_submit()
+ */
+typedef struct {
+    mraa_i2c_msg* msgs;    /**< Segments, they and their buffers must stay valid until the callback */
+    unsigned int num_msgs; /**< Number of segments, at most 42 */
+    int priority;          /**< Higher runs first, equal priorities run in submission order */
+    void* user_data;       /**< Left to the caller */
+} mraa_i2c_job;
+
+/**
+ * Completion callback of a job, run on the worker thread of the bus
+ */
+typedef void (*mraa_i2c_job_cb)(mraa_i2c_job* job, mraa_result_t result);
+
+/**
+ * Byte order of 16-bit words on the bus
+ */
+typedef enum {
+    MRAA_I2C_BIG_ENDIAN = 0,    /**< Most significant byte first */
+    MRAA_I2C_LITTLE_ENDIAN = 1, /**< Least significant byte first, SMBus order */
+} mraa_i2c_endian_t;
+
+/**
+ * One register range of a scatter-gather read
+ */
+typedef struct {
+    uint16_t reg; /**< First register */
+    uint16_t len; /**< Number of bytes to read from reg on */
+    uint8_t* buf; /**< Buffer of len bytes */
+} mraa_i2c_reg_block;
+
+/**
+ * Opaque pointer to a register poller started by mraa_i2c_poller_start()
+ */
+typedef struct _i2c_poller* mraa_i2c_poller;
+
+/**
+ * Register range read periodically by a poller
+ */
+typedef struct {
+    int bus;                /**< i2c bus number, as given to mraa_i2c_init() */
+    uint8_t addr;           /**< 7-bit address of the slave */
+    uint8_t reg;            /**< First register, the device must auto-increment */
+    uint16_t len;           /**< Number of bytes to read, reg + len at most 256 */
+    unsigned int period_ms; /**< Rounded up to a multiple of the tick */
+} mraa_i2c_poll_desc;
+
 /**
  * Initialise i2c context, using board defintions
  *
@@ -128,12 +194,15 @@ int mraa_i2c_read_bytes_data(mraa_i2c_context dev, uint8_t command, uint8_t* dat
 
 /**
  * Write length bytes to the bus, the first byte in the array is the
- * command/register to write
+ * command/register to write. The bytes go out as one message, they are never
+ * split: a buffer longer than the adapter takes at once (33 bytes on SMBus
+ * only adapters) is refused rather than written to the wrong registers.
  *
  * @param dev The i2c context
  * @param data pointer to the byte array to be written
  * @param length the number of bytes to transmit
- * @return Result of operation
+ * @return Result of operation, MRAA_ERROR_INVALID_PARAMETER if the adapter
+ * cannot take length bytes in one message
  */
 mraa_result_t mraa_i2c_write(mraa_i2c_context dev, const uint8_t* data, int length);
 
@@ -166,6 +235,84 @@ mraa_result_t mraa_i2c_write_byte_data(mraa_i2c_context dev, const uint8_t data,
  */
 mraa_result_t mraa_i2c_write_word_data(mraa_i2c_context dev, const uint16_t data, const uint8_t command);
 
+/**
+ * Run several write and read segments as one combined transaction, each
+ * segment starting with a repeated start and a single stop at the end. The
+ * whole list is handed to the kernel in one I2C_RDWR ioctl, so e.g. writing a
+ * 16-bit register address and reading a burst back costs one round trip.
+ * Every message carries its own address, the one of the context is not used.
+ *
+ * @param dev The i2c context
+ * @param msgs Segments in bus order, read segments are filled in place
+ * @param num_msgs Number of segments, at most 42
+ * @return Result of operation
+ */
+mraa_result_t mraa_i2c_transfer(mraa_i2c_context dev, mraa_i2c_msg msgs[], unsigned int num_msgs);
+
+/**
+ * Bulk read from a device with 16-bit register addresses, such as EEPROMs.
+ * The address is sent big-endian, followed by a repeated start and the read,
+ * in one transaction.
+ *
+ * @param dev The i2c context
+ * @param reg The register
+ * @param data pointer to the byte array to read data in to
+ * @param length number of bytes to read
+ * @return The length in bytes passed to the function or -1
+ */
+int mraa_i2c_read_bytes_reg16(mraa_i2c_context dev, uint16_t reg, uint8_t* data, int length);
+
+/**
+ * Bulk write to a device with 16-bit register addresses, the address is sent
+ * big-endian and followed by the data in one message.
+ *
+ * @param dev The i2c context
+ * @param reg The register
+ * @param data pointer to the byte array to write
+ * @param length number of bytes to write, at most 8190
+ * @return Result of operation
+ */
+mraa_result_t mraa_i2c_write_bytes_reg16(mraa_i2c_context dev, uint16_t reg, const uint8_t* data, int length);
+
+/**
+ * Read consecutive 16-bit words starting from a register in one transaction,
+ * converted from the byte order of the device to host order.
+ *
+ * @param dev The i2c context
+ * @param command The register
+ * @param words array receiving count words
+ * @param count number of words to read
+ * @param endian byte order of the device
+ * @return count or -1
+ */
+int mraa_i2c_read_words_data(mraa_i2c_context dev, uint8_t command, uint16_t* words, int count, mraa_i2c_endian_t endian);
+
+/**
+ * Write consecutive 16-bit words starting from a register in one message,
+ * converted from host order to the byte order of the device.
+ *
+ * @param dev The i2c context
+ * @param command The register
+ * @param words array of count words
+ * @param count number of words to write, at most 4095
+ * @param endian byte order of the device
+ * @return Result of operation
+ */
+mraa_result_t mraa_i2c_write_words_data(mraa_i2c_context dev, uint8_t command, const uint16_t* words, int count, mraa_i2c_endian_t endian);
+
+/**
+ * Read several register ranges of an auto-increment device in one
+ * transaction, each range being a register write and a read behind a
+ * repeated start.
+ *
+ * @param dev The i2c context
+ * @param blocks Ranges to read, filled in place
+ * @param num_blocks Number of ranges, at most 21
+ * @param reg16 Register addresses are 16-bit, sent big-endian
+ * @return Result of operation
+ */
+mraa_result_t mraa_i2c_read_reg_blocks(mraa_i2c_context dev, mraa_i2c_reg_block blocks[], unsigned int num_blocks, mraa_boolean_t reg16);
+
 /**
  * Sets the i2c slave address.
  *
@@ -176,11 +323,105 @@ mraa_result_t mraa_i2c_write_word_data(mraa_i2c_context dev, const uint16_t data
 mraa_result_t mraa_i2c_address(mraa_i2c_context dev, uint8_t address);
 
 /**
- * De-inits an mraa_i2c_context device
+ * Queue a transaction to run on a worker thread of the bus, the call returns
+ * without waiting for the bus. Every bus has a single worker serving the jobs
+ * of all its contexts, by priority and in submission order within a priority,
+ * running queued jobs back to back. Read segments are filled when cb runs.
+ * cb must not call mraa_i2c_stop() or mraa_i2c_wait_jobs() on the context;
+ * it may submit new jobs.
+ * A context should submit from one thread at a time.
+ *
+ * @param dev The i2c context
+ * @param job The transaction, owned by the caller
+ * @param cb Called with the result once the job ran, may be NULL
+ * @return Result of queuing the job
+ */
+mraa_result_t mraa_i2c_submit(mraa_i2c_context dev, mraa_i2c_job* job, mraa_i2c_job_cb cb);
+
+/**
+ * Number of jobs queued or running on the bus of the context, from every
+ * context of the bus
+ *
+ * @param dev The i2c context
+ * @return Queue depth, 0 if nothing was ever submitted through dev
+ */
+unsigned int mraa_i2c_queue_depth(mraa_i2c_context dev);
+
+/**
+ * Wait until every job submitted through the context completed, its
+ * callback included. mraa_i2c_stop() does this too. Callbacks must not call
+ * it: they run on the worker of the bus, which would wait for itself.
+ *
+ * @param dev The i2c context
+ * @return Result of operation, MRAA_ERROR_INVALID_RESOURCE when called from
+ * a job callback
+ */
+mraa_result_t mraa_i2c_wait_jobs(mraa_i2c_context dev);
+
+/**
+ * Open a transaction scope on the bus of the context. Until the matching
+ * mraa_i2c_end() no other thread can use the bus, through this or any other
+ * context, so a sequence such as select page / read register stays atomic.
+ * Every transfer locks its bus anyway, different buses never wait on each
+ * other. Scopes nest and must end in the thread that began them.
+ *
+ * @param dev The i2c context
+ * @return Result of operation, MRAA_ERROR_FEATURE_NOT_SUPPORTED on buses
+ * not backed by /dev/i2c-*
+ */
+mraa_result_t mraa_i2c_begin(mraa_i2c_context dev);
+
+/**
+ * Close the transaction scope opened by mraa_i2c_begin()
  *
  * @param dev The i2c context
  * @return Result of operation
  */
+mraa_result_t mraa_i2c_end(mraa_i2c_context dev);
+
+/**
+ * Read register ranges in the background, each at its own period. Every bus
+ * gets a thread of its own waking once a tick; ranges of a device due in the
+ * same tick are read as one block when they overlap or touch, and the blocks
+ * of all devices on the bus share as few I2C_RDWR transactions as possible.
+ * Results land in a double-buffered snapshot that mraa_i2c_poller_read()
+ * copies without ever blocking the poller.
+ *
+ * @param descs Ranges to read, copied
+ * @param num_descs Number of ranges
+ * @param tick_ms Wake up period of the poller threads
+ * @return poller or NULL on failure
+ */
+mraa_i2c_poller mraa_i2c_poller_start(const mraa_i2c_poll_desc descs[], unsigned int num_descs, unsigned int tick_ms);
+
+/**
+ * Copy the latest bytes read for a range. A failed read keeps the previous
+ * bytes and timestamp, only the returned status changes.
+ *
+ * @param poller The poller
+ * @param idx Index of the range in the descriptors given at start
+ * @param data Buffer of len bytes, zeroes before the first good read
+ * @param timestamp CLOCK_MONOTONIC time of the last good read in ns, 0
+ * before it, may be NULL
+ * @return Result of the last read of the range, MRAA_ERROR_INVALID_RESOURCE
+ * before the first one
+ */
+mraa_result_t mraa_i2c_poller_read(mraa_i2c_poller poller, unsigned int idx, uint8_t* data, mraa_timestamp_t* timestamp);
+
+/**
+ * Stop the poller threads and free the poller
+ *
+ * @param poller The poller
+ */
+void mraa_i2c_poller_stop(mraa_i2c_poller poller);
+
+/**
+ * De-inits an mraa_i2c_context device, after its queued jobs completed
+ *
+ * @param dev The i2c context
+ * @return Result of operation, MRAA_ERROR_INVALID_RESOURCE when called from
+ * a job callback, the context then stays open
+ */
 mraa_result_t mraa_i2c_stop(mraa_i2c_context dev);
 
 #ifdef __cplusplus
@@ -29,6 +29,7 @@
 #include "i2c.h"
 #include "types.hpp"
 #include <stdexcept>
+#include <vector>
 
 namespace mraa
 {
@@ -258,6 +259,171 @@ class I2c
         return (Result) mraa_i2c_write_word_data(m_i2c, data, reg);
     }
 
+    /**
+     * Run several write and read segments as one combined transaction with
+     * repeated starts, in a single kernel round trip
+     *
+     * @param msgs Segments in bus order, read segments are filled in place
+     * @param num_msgs Number of segments, at most 42
+     * @return Result of operation
+     */
+    Result
+    transfer(mraa_i2c_msg* msgs, unsigned int num_msgs)
+    {
+        return (Result) mraa_i2c_transfer(m_i2c, msgs, num_msgs);
+    }
+
+    /**
+     * Run several write and read segments as one combined transaction
+     *
+     * @param msgs Segments in bus order, read segments are filled in place
+     * @return Result of operation
+     */
+    Result
+    transfer(std::vector<mraa_i2c_msg>& msgs)
+    {
+        return (Result) mraa_i2c_transfer(m_i2c, msgs.data(), msgs.size());
+    }
+
+    /**
+     * Read length bytes from a device with 16-bit register addresses
+     *
+     * @param reg Register to read from
+     * @param length Number of bytes to read
+     *
+     * @throws std::invalid_argument in case of error
+     * @return bytes read
+     */
+    std::vector<uint8_t>
+    readBytesReg16(uint16_t reg, int length)
+    {
+        std::vector<uint8_t> data(length);
+        if (mraa_i2c_read_bytes_reg16(m_i2c, reg, data.data(), length) != length) {
+            throw std::invalid_argument("Unknown error in I2c::readBytesReg16()");
+        }
+        return data;
+    }
+
+    /**
+     * Write bytes to a device with 16-bit register addresses
+     *
+     * @param reg Register to write to
+     * @param data Bytes to write
+     * @return Result of operation
+     */
+    Result
+    writeBytesReg16(uint16_t reg, const std::vector<uint8_t>& data)
+    {
+        return (Result) mraa_i2c_write_bytes_reg16(m_i2c, reg, data.data(), data.size());
+    }
+
+    /**
+     * Read consecutive words starting from a register, in host order
+     *
+     * @param reg Register to read from
+     * @param count Number of words to read
+     * @param endian Byte order of the device
+     *
+     * @throws std::invalid_argument in case of error
+     * @return words read
+     */
+    std::vector<uint16_t>
+    readWordsReg(uint8_t reg, int count, I2cEndian endian = I2C_BIG_ENDIAN)
+    {
+        std::vector<uint16_t> words(count);
+        if (mraa_i2c_read_words_data(m_i2c, reg, words.data(), count, (mraa_i2c_endian_t) endian) != count) {
+            throw std::invalid_argument("Unknown error in I2c::readWordsReg()");
+        }
+        return words;
+    }
+
+    /**
+     * Write consecutive words starting from a register
+     *
+     * @param reg Register to write to
+     * @param words Words in host order
+     * @param endian Byte order of the device
+     * @return Result of operation
+     */
+    Result
+    writeWordsReg(uint8_t reg, const std::vector<uint16_t>& words, I2cEndian endian = I2C_BIG_ENDIAN)
+    {
+        return (Result) mraa_i2c_write_words_data(m_i2c, reg, words.data(), words.size(), (mraa_i2c_endian_t) endian);
+    }
+
+    /**
+     * Read several register ranges in one transaction
+     *
+     * @param blocks Ranges to read, filled in place
+     * @param reg16 Register addresses are 16-bit
+     * @return Result of operation
+     */
+    Result
+    readRegBlocks(std::vector<mraa_i2c_reg_block>& blocks, bool reg16 = false)
+    {
+        return (Result) mraa_i2c_read_reg_blocks(m_i2c, blocks.data(), blocks.size(), reg16);
+    }
+
+    /**
+     * Queue a transaction on the worker thread of the bus, see
+     * mraa_i2c_submit()
+     *
+     * @param job The transaction, must stay valid until cb ran
+     * @param cb Called with the result on the worker thread, may be NULL
+     * @return Result of queuing the job
+     */
+    Result
+    submit(mraa_i2c_job* job, mraa_i2c_job_cb cb)
+    {
+        return (Result) mraa_i2c_submit(m_i2c, job, cb);
+    }
+
+    /**
+     * Number of jobs queued or running on the bus
+     *
+     * @return Queue depth
+     */
+    unsigned int
+    queueDepth()
+    {
+        return mraa_i2c_queue_depth(m_i2c);
+    }
+
+    /**
+     * Wait until every job submitted through this object completed, never
+     * from a job callback
+     *
+     * @return Result of operation
+     */
+    Result
+    waitJobs()
+    {
+        return (Result) mraa_i2c_wait_jobs(m_i2c);
+    }
+
+    /**
+     * Keep other threads off the bus until end(), so several transfers run
+     * as one atomic sequence
+     *
+     * @return Result of operation
+     */
+    Result
+    begin()
+    {
+        return (Result) mraa_i2c_begin(m_i2c);
+    }
+
+    /**
+     * Close the scope opened by begin()
+     *
+     * @return Result of operation
+     */
+    Result
+    end()
+    {
+        return (Result) mraa_i2c_end(m_i2c);
+    }
+
   private:
     mraa_i2c_context m_i2c;
 };
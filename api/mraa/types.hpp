@@ -247,6 +247,22 @@ typedef enum {
     I2C_HIGH = 2  /**< up to 3.4Mhz */
 } I2cMode;
 
+/**
+ * Enum representing the flags of an i2c message, see mraa_i2c_msg
+ */
+typedef enum {
+    I2C_MSG_READ = 0x0001,   /**< Read into buf, the message writes buf otherwise */
+    I2C_MSG_NOSTART = 0x4000 /**< Continue the previous message without a repeated start */
+} I2cMsgFlag;
+
+/**
+ * Enum representing the byte order of 16-bit i2c words
+ */
+typedef enum {
+    I2C_BIG_ENDIAN = 0,   /**< Most significant byte first */
+    I2C_LITTLE_ENDIAN = 1 /**< Least significant byte first, SMBus order */
+} I2cEndian;
+
 /**
  * Enum representing different uart parity states
  */
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Example usage: Measures the per-call latency of single pin GPIO reads and
+ * writes, through the direct single-pin path and through the multi-pin API
+ * with a one element array. Runs on the mock platform with the default pin.
+ *
+ *      gpio_latency [pin] [iterations]
+ *
+ */
+
+/* standard headers */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* mraa header */
+#include "mraa/gpio.h"
+
+/* gpio declaration */
+#define GPIO_PIN 0
+#define ITERATIONS 100000
+
+static double
+elapsed_ns(struct timespec* start, struct timespec* end)
+{
+    return (double) (end->tv_sec - start->tv_sec) * 1e9 + (double) (end->tv_nsec - start->tv_nsec);
+}
+
+int
+main(int argc, char** argv)
+{
+    mraa_result_t status = MRAA_SUCCESS;
+    mraa_gpio_context gpio;
+    struct timespec start, end;
+    int pin = GPIO_PIN;
+    long iterations = ITERATIONS;
+    int values[1] = { 0 };
+    long i;
+
+    if (argc > 1) {
+        pin = (int) strtol(argv[1], NULL, 10);
+    }
+    if (argc > 2) {
+        iterations = strtol(argv[2], NULL, 10);
+    }
+    if (iterations <= 0) {
+        fprintf(stderr, "Invalid iteration count\n");
+        return EXIT_FAILURE;
+    }
+
+    /* initialize mraa for the platform (not needed most of the times) */
+    mraa_init();
+
+    //! [Interesting]
+    /* initialize GPIO pin */
+    gpio = mraa_gpio_init(pin);
+    if (gpio == NULL) {
+        fprintf(stderr, "Failed to initialize GPIO %d\n", pin);
+        mraa_deinit();
+        return EXIT_FAILURE;
+    }
+
+    /* set GPIO to output */
+    status = mraa_gpio_dir(gpio, MRAA_GPIO_OUT);
+    if (status != MRAA_SUCCESS) {
+        goto err_exit;
+    }
+
+    /* single pin write */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < iterations; i++) {
+        status = mraa_gpio_write(gpio, (int) (i & 1));
+        if (status != MRAA_SUCCESS) {
+            goto err_exit;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    fprintf(stdout, "mraa_gpio_write:       %10.1f ns/call\n", elapsed_ns(&start, &end) / iterations);
+
+    /* one element multi pin write */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < iterations; i++) {
+        values[0] = (int) (i & 1);
+        status = mraa_gpio_write_multi(gpio, values);
+        if (status != MRAA_SUCCESS) {
+            goto err_exit;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    fprintf(stdout, "mraa_gpio_write_multi: %10.1f ns/call\n", elapsed_ns(&start, &end) / iterations);
+
+    /* single pin read */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < iterations; i++) {
+        if (mraa_gpio_read(gpio) == -1) {
+            status = MRAA_ERROR_INVALID_RESOURCE;
+            goto err_exit;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    fprintf(stdout, "mraa_gpio_read:        %10.1f ns/call\n", elapsed_ns(&start, &end) / iterations);
+
+    /* one element multi pin read */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < iterations; i++) {
+        status = mraa_gpio_read_multi(gpio, values);
+        if (status != MRAA_SUCCESS) {
+            goto err_exit;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    fprintf(stdout, "mraa_gpio_read_multi:  %10.1f ns/call\n", elapsed_ns(&start, &end) / iterations);
+
+    /* close GPIO */
+    mraa_gpio_close(gpio);
+
+    //! [Interesting]
+    /* deinitialize mraa for the platform (not needed most of the times) */
+    mraa_deinit();
+
+    return EXIT_SUCCESS;
+
+err_exit:
+    mraa_result_print(status);
+    mraa_gpio_close(gpio);
+
+    /* deinitialize mraa for the platform (not needed most of the times) */
+    mraa_deinit();
+
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Example usage: Drives a stepper driver STEP/DIR pair with a precompiled
+ * waveform, 100 steps forward with a 10 us pulse every 500 us, and prints the
+ * timing achieved by the sequencer. Runs on the mock platform with the
+ * default pins.
+ *
+ *      gpio_sequence [step pin] [dir pin]
+ *
+ */
+
+/* standard headers */
+#include <stdio.h>
+#include <stdlib.h>
+
+/* mraa header */
+#include "mraa/gpio.h"
+
+/* gpio declaration */
+#define STEP_PIN 0
+#define DIR_PIN 1
+#define STEP_COUNT 100
+
+int
+main(int argc, char** argv)
+{
+    mraa_result_t status = MRAA_SUCCESS;
+    mraa_gpio_context gpio;
+    mraa_gpio_sequence seq;
+    mraa_gpio_seq_stats stats;
+    int pins[2] = { STEP_PIN, DIR_PIN };
+
+    if (argc > 2) {
+        pins[0] = (int) strtol(argv[1], NULL, 10);
+        pins[1] = (int) strtol(argv[2], NULL, 10);
+    }
+
+    /* bit 0 is STEP, bit 1 is DIR: set DIR, then pulse STEP */
+    mraa_gpio_seq_step steps[] = {
+        { .mask = 0x3, .values = 0x2, .delay_ns = 10000 },
+        { .mask = 0x1, .values = 0x1, .delay_ns = 10000 },
+        { .mask = 0x1, .values = 0x0, .delay_ns = 480000 },
+    };
+
+    /* initialize mraa for the platform (not needed most of the times) */
+    mraa_init();
+
+    //! [Interesting]
+    /* initialize both GPIO pins in one context */
+    gpio = mraa_gpio_init_multi(pins, 2);
+    if (gpio == NULL) {
+        fprintf(stderr, "Failed to initialize GPIO %d and %d\n", pins[0], pins[1]);
+        mraa_deinit();
+        return EXIT_FAILURE;
+    }
+
+    /* set GPIOs to output */
+    status = mraa_gpio_dir(gpio, MRAA_GPIO_OUT);
+    if (status != MRAA_SUCCESS) {
+        goto err_exit;
+    }
+
+    /* compile the waveform once, run it STEP_COUNT times */
+    seq = mraa_gpio_sequence_new(gpio, steps, sizeof(steps) / sizeof(steps[0]));
+    if (seq == NULL) {
+        status = MRAA_ERROR_NO_RESOURCES;
+        goto err_exit;
+    }
+
+    status = mraa_gpio_sequence_run(seq, STEP_COUNT, 50, &stats);
+    mraa_gpio_sequence_free(seq);
+    if (status != MRAA_SUCCESS) {
+        goto err_exit;
+    }
+
+    fprintf(stdout, "steps:     %u\n", stats.steps);
+    fprintf(stdout, "duration:  %llu ns\n", stats.duration_ns);
+    fprintf(stdout, "late mean: %llu ns\n", stats.late_mean_ns);
+    fprintf(stdout, "late max:  %llu ns\n", stats.late_max_ns);
+    fprintf(stdout, "overruns:  %u\n", stats.overruns);
+
+    /* close GPIO */
+    mraa_gpio_close(gpio);
+
+    //! [Interesting]
+    /* deinitialize mraa for the platform (not needed most of the times) */
+    mraa_deinit();
+
+    return EXIT_SUCCESS;
+
+err_exit:
+    mraa_result_print(status);
+    mraa_gpio_close(gpio);
+
+    /* deinitialize mraa for the platform (not needed most of the times) */
+    mraa_deinit();
+
+    return EXIT_FAILURE;
+}
@@ -14,17 +14,22 @@ extern "C" {
 #include "mraa_internal.h"
 #include "linux/gpio.h"
 
+/* Bitmap covering the first n lines of a line request. */
+#define MRAA_GPIOD_LINES_MASK(n) ((n) >= 64 ? ~0ULL : (1ULL << (n)) - 1)
+
 typedef struct {
     int chip_fd;
     struct gpiochip_info chip_info;
 } mraa_gpiod_chip_info;
 
-typedef struct gpioline_info mraa_gpiod_line_info;
+typedef struct gpio_v2_line_info mraa_gpiod_line_info;
+
+/* Multiple gpio support. */
+typedef struct _gpio_group* mraa_gpiod_group_t;
 
 void _mraa_free_gpio_groups(mraa_gpio_context dev);
-void _mraa_close_gpio_event_handles(mraa_gpio_context dev);
-void _mraa_close_gpio_desc(mraa_gpio_context dev);
 int _mraa_gpiod_ioctl(int fd, unsigned long gpio_request, void* data);
+int _mraa_gpiod_configure_group(mraa_gpiod_group_t group);
 
 mraa_gpiod_chip_info* mraa_get_chip_info_by_path(const char* path);
 mraa_gpiod_chip_info* mraa_get_chip_info_by_name(const char* name);
@@ -36,7 +41,11 @@ mraa_gpiod_line_info* mraa_get_line_info_by_chip_number(unsigned chip_number, un
 mraa_gpiod_line_info* mraa_get_line_info_by_chip_name(const char* chip_name, unsigned line_number);
 mraa_gpiod_line_info* mraa_get_line_info_by_chip_label(const char* chip_label, unsigned line_number);
 
-int mraa_get_lines_handle(int chip_fd, unsigned line_offsets[], unsigned num_lines, unsigned flags, unsigned default_value);
+void mraa_get_lines_config(mraa_gpiod_group_t group, struct gpio_v2_line_config* config);
+int mraa_get_lines_handle(int chip_fd, unsigned line_offsets[], unsigned num_lines, struct gpio_v2_line_config* config);
+int mraa_set_lines_config(int line_handle, struct gpio_v2_line_config* config);
+int mraa_set_line_bits(int line_handle, uint64_t mask, uint64_t bits);
+int mraa_get_line_bits(int line_handle, uint64_t mask, uint64_t* bits);
 int mraa_set_line_values(int line_handle, unsigned int num_lines, unsigned char input_values[]);
 int mraa_get_line_values(int line_handle, unsigned int num_lines, unsigned char output_values[]);
 
@@ -48,10 +57,7 @@ mraa_boolean_t mraa_is_gpio_line_open_source(mraa_gpiod_line_info *linfo);
 
 int mraa_get_number_of_gpio_chips();
 int mraa_get_chip_infos(mraa_gpiod_chip_info*** cinfos);
-
-/* Multiple gpio support. */
-typedef struct _gpio_group* mraa_gpiod_group_t;
-
+mraa_boolean_t mraa_is_gpiod_v2_capable();
 
 #ifdef __cplusplus
 }
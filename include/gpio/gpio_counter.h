@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <pthread.h>
+
+#include "mraa_internal.h"
+
+/* Slices of the sliding frequency window. */
+#define MRAA_GPIO_COUNTER_BUCKETS 16
+/* Window used when mraa_gpio_counter_start() is given 0. */
+#define MRAA_GPIO_COUNTER_DEFAULT_WINDOW_MS 1000
+
+/*
+ * Counters of one line. Readers never block the interrupt handler: every
+ * update bumps seq to an odd value first and back to even once done, readers
+ * retry until they copied the line between two equal even values.
+ */
+struct _gpio_counter_line {
+    unsigned int seq;
+    uint64_t count;    /**< edges since start or the last reset */
+    uint64_t start_ns; /**< CLOCK_MONOTONIC time counting (re)started */
+    uint64_t bucket_epoch[MRAA_GPIO_COUNTER_BUCKETS]; /**< slice number the bucket counts for */
+    uint32_t bucket_count[MRAA_GPIO_COUNTER_BUCKETS];
+};
+
+struct _gpio_counter {
+    uint64_t bucket_ns;
+    unsigned int num_lines; /**< one per pin given at init, in that order */
+    pthread_mutex_t lock;   /**< serialises the handler and mraa_gpio_counter_reset() */
+    struct _gpio_counter_line* lines;
+};
+
+typedef struct _gpio_counter* mraa_gpio_counter_t;
+
+mraa_gpio_counter_t mraa_gpio_counter_new(unsigned int num_lines, unsigned int window_ms);
+void mraa_gpio_counter_free(mraa_gpio_counter_t counter);
+void mraa_gpio_counter_edge(mraa_gpio_counter_t counter, int line, uint64_t timestamp_ns);
+void mraa_gpio_counter_clear(mraa_gpio_counter_t counter);
+mraa_result_t mraa_gpio_counter_get(mraa_gpio_counter_t counter, unsigned int line, mraa_gpio_counter_value* value);
+mraa_result_t mraa_gpio_counter_get_at(mraa_gpio_counter_t counter, unsigned int line, uint64_t now_ns, mraa_gpio_counter_value* value);
+
+#ifdef __cplusplus
+}
+#endif
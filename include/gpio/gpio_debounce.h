@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mraa_internal.h"
+
+struct _gpio_debounce_line {
+    int level;              /**< last reported level, -1 until the first edge */
+    int pending;            /**< level waiting to prove stable, -1 when none */
+    uint64_t pending_since; /**< CLOCK_MONOTONIC time of the edge that set pending */
+};
+
+/*
+ * Software filter used when the kernel cannot debounce. Every edge restarts
+ * the stable window of its line, the level is only reported once the window
+ * elapses without another edge, so bounces collapse into one edge and glitches
+ * shorter than the window into none. timer_fd fires at the earliest deadline.
+ */
+struct _gpio_debounce {
+    uint64_t stable_ns;
+    unsigned int vote;      /**< samples taken to confirm a level, 0 or 1 trusts the edge */
+    unsigned int num_lines; /**< one per entry of the context's events array */
+    int timer_fd;
+    struct _gpio_debounce_line* lines;
+};
+
+typedef struct _gpio_debounce* mraa_gpio_debounce_t;
+
+/* A line whose window elapsed, as returned by mraa_gpio_debounce_expire(). */
+typedef struct {
+    int line;
+    int level;
+    uint64_t since;
+} mraa_gpio_debounce_ready;
+
+mraa_gpio_debounce_t mraa_gpio_debounce_new(unsigned int num_lines, unsigned int stable_us, unsigned int vote);
+void mraa_gpio_debounce_free(mraa_gpio_debounce_t debounce);
+void mraa_gpio_debounce_reset(mraa_gpio_debounce_t debounce);
+void mraa_gpio_debounce_edge(mraa_gpio_debounce_t debounce, int line, int level, uint64_t timestamp_ns);
+unsigned int mraa_gpio_debounce_expire(mraa_gpio_debounce_t debounce, mraa_gpio_debounce_ready* ready);
+mraa_boolean_t mraa_gpio_debounce_commit(mraa_gpio_debounce_t debounce, int line, int level);
+
+#ifdef __cplusplus
+}
+#endif
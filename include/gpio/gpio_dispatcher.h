@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mraa_internal.h"
+
+mraa_boolean_t mraa_gpio_dispatcher_running();
+/* On success the dispatcher owns fds, sysfs fds are closed on unregister. */
+mraa_result_t mraa_gpio_dispatcher_register(mraa_gpio_context dev, int fds[], int num_fds, mraa_boolean_t sysfs);
+mraa_result_t mraa_gpio_dispatcher_unregister(mraa_gpio_context dev);
+
+/* Implemented by the gpio core, called from a worker for a readable event fd. */
+void _mraa_gpio_dispatch_event(mraa_gpio_context dev, int fd_idx, int fd);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <pthread.h>
+
+#include "mraa_internal.h"
+
+/* Default number of events a context can queue, must be a power of two. */
+#define MRAA_GPIO_EVENT_RING_SIZE 1024
+
+/*
+ * Single producer event queue. The interrupt handler thread is the only
+ * producer, so head only needs acquire / release ordering and pushing never
+ * takes a lock. Several threads may call mraa_gpio_capture_read() on one
+ * context, they take the consumer lock to move tail and each event goes to
+ * exactly one of them.
+ */
+struct _gpio_event_ring {
+    mraa_gpio_capture_event* slots;
+    unsigned int size;
+    unsigned int head;    /**< next slot to fill, written by the producer */
+    unsigned int tail;    /**< next slot to drain, written under consume */
+    pthread_mutex_t consume; /**< serialises consumers, never taken by the producer */
+    unsigned int dropped; /**< events lost because the ring was full or the kernel overflowed */
+    int wake_fd;          /**< eventfd signalled once per produced batch */
+    unsigned int readers; /**< consumers inside mraa_gpio_event_ring_enter() / leave() */
+    mraa_boolean_t closing; /**< set by mraa_gpio_event_ring_close(), waiting readers return -1 */
+};
+
+typedef struct _gpio_event_ring* mraa_gpio_event_ring_t;
+
+mraa_gpio_event_ring_t mraa_gpio_event_ring_new(unsigned int size);
+void mraa_gpio_event_ring_free(mraa_gpio_event_ring_t ring);
+int mraa_gpio_event_ring_push(mraa_gpio_event_ring_t ring, const mraa_gpio_capture_event* event);
+void mraa_gpio_event_ring_add_dropped(mraa_gpio_event_ring_t ring, unsigned int count);
+unsigned int mraa_gpio_event_ring_dropped(mraa_gpio_event_ring_t ring);
+void mraa_gpio_event_ring_notify(mraa_gpio_event_ring_t ring);
+unsigned int mraa_gpio_event_ring_pop(mraa_gpio_event_ring_t ring, mraa_gpio_capture_event* buf, unsigned int max);
+int mraa_gpio_event_ring_wait(mraa_gpio_event_ring_t ring, mraa_gpio_capture_event* buf, unsigned int max, int timeout_ms);
+mraa_gpio_event_ring_t mraa_gpio_event_ring_enter(mraa_gpio_event_ring_t* slot);
+void mraa_gpio_event_ring_leave(mraa_gpio_event_ring_t ring);
+void mraa_gpio_event_ring_close(mraa_gpio_event_ring_t* slot);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <pthread.h>
+
+#include "mraa_internal.h"
+
+/*
+ * One mapping of a register block, shared by every context of the process
+ * that maps the same device at the same offset.
+ */
+struct _gpio_mmap_region {
+    char mem_dev[32];
+    uint64_t base;          /**< page aligned offset handed to mmap() */
+    size_t size;            /**< length of the mapping */
+    uint8_t* map;
+    int fd;
+    unsigned int refcount;  /**< contexts using the mapping, protected by the registry lock */
+    pthread_mutex_t lock;   /**< serialises read-modify-write of shared registers */
+    struct _gpio_mmap_region* next;
+};
+
+/* Registers of one bank, resolved once when mmap is enabled on a context. */
+struct _gpio_mmap_bank {
+    volatile uint32_t* set;   /**< NULL when the board has no such register */
+    volatile uint32_t* clear;
+    volatile uint32_t* data;
+    volatile uint32_t* level;
+    volatile uint32_t* dir;
+    unsigned int index;       /**< bank number inside the controller */
+    uint32_t mask;            /**< lines of the context inside this bank */
+};
+
+/* The pins of a context grouped by bank, so a port write is one store per register. */
+struct _gpio_mmap_port {
+    struct _gpio_mmap_region* region;
+    struct _gpio_mmap_bank* banks;
+    unsigned int num_banks;
+    unsigned int* pin_bank;   /**< bank of each pin of the context */
+    uint32_t* pin_mask;       /**< bit of each pin inside its bank registers */
+    unsigned int num_pins;
+    mraa_boolean_t dir_out_high;
+};
+
+struct _gpio_mmap_region* mraa_gpio_mmap_region_acquire(const mraa_gpio_mmap_desc_t* desc);
+void mraa_gpio_mmap_region_release(struct _gpio_mmap_region* region);
+
+/* Generic implementation of mraa_gpio_use_mmaped() for boards with a descriptor. */
+mraa_result_t mraa_gpio_mmap_setup(mraa_gpio_context dev, const mraa_gpio_mmap_desc_t* desc, mraa_boolean_t en);
+mraa_result_t mraa_gpio_mmap_dir(mraa_gpio_context dev, mraa_gpio_dir_t dir);
+/* One store per register of every bank, set_bits and clear_bits are indexed by bank. */
+void mraa_gpio_mmap_apply(struct _gpio_mmap_port* port, const uint32_t set_bits[], const uint32_t clear_bits[]);
+mraa_result_t mraa_gpio_mmap_write_multi(mraa_gpio_context dev, int input_values[]);
+mraa_result_t mraa_gpio_mmap_write_mask(mraa_gpio_context dev, uint64_t values, uint64_t mask);
+mraa_result_t mraa_gpio_mmap_read_multi(mraa_gpio_context dev, int output_values[]);
+
+#ifdef __cplusplus
+}
+#endif
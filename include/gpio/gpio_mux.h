@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mraa_internal.h"
+
+/* What a compiled step does to its mux gpio. */
+typedef enum {
+    MRAA_MUX_OP_WRITE = 0,  /**< write value */
+    MRAA_MUX_OP_DIR,        /**< set direction value */
+    MRAA_MUX_OP_OUT,        /**< output at level value, one OUT_HIGH / OUT_LOW write */
+    MRAA_MUX_OP_OUT_LEGACY, /**< as OUT, but only the level has to land (PINCMD_UNDEFINED) */
+    MRAA_MUX_OP_IN_VALUE,   /**< input, then write value */
+    MRAA_MUX_OP_MODE        /**< set mode value */
+} mraa_mux_op_t;
+
+struct _gpio_mux_step {
+    unsigned int pin; /**< raw gpio */
+    mraa_mux_op_t op;
+    unsigned int value;
+};
+
+/*
+ * The mux list of one pin function, compiled once: skipped and duplicate
+ * commands dropped, direction and level merged into one write. Plans are
+ * cached for the life of the process, keyed by the mux list they came from.
+ */
+struct _gpio_mux_plan {
+    mraa_mux_t mux[6];
+    unsigned int mux_total;
+    struct _gpio_mux_step steps[6];
+    unsigned int num_steps;
+    struct _gpio_mux_plan* next;
+};
+
+typedef struct _gpio_mux_plan* mraa_gpio_mux_plan_t;
+
+/* Compile a mux list, or find it already compiled. */
+mraa_gpio_mux_plan_t mraa_gpio_mux_plan_get(const mraa_pin_t* meta);
+/* Apply a plan through the pool of raw mux contexts, which stay open. */
+mraa_result_t mraa_gpio_mux_plan_run(mraa_gpio_mux_plan_t plan);
+/* Drop every plan and close the pooled contexts. */
+void mraa_gpio_mux_cleanup();
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mraa_internal.h"
+
+/* Smallest ring accepted, anything below holds too few edges to be useful. */
+#define MRAA_GPIO_RECORD_MIN_SIZE 4096
+/* Longest record: the pin and level byte, then a 64 bit varint. */
+#define MRAA_GPIO_RECORD_MAX_LEN 11
+
+/*
+ * Writer side of a recording. Only the interrupt handler appends, so the
+ * header in the mapping is updated without a lock; the file is read once
+ * the handler is gone.
+ */
+struct _gpio_recorder {
+    mraa_gpio_record_header* header; /**< start of the mapping */
+    uint8_t* data;                   /**< ring, header->capacity bytes */
+    size_t map_size;
+    int fd;
+    mraa_timestamp_t last_timestamp; /**< time the next delta is relative to */
+};
+
+typedef struct _gpio_recorder* mraa_gpio_recorder_t;
+
+mraa_gpio_recorder_t mraa_gpio_recorder_new(const char* path, size_t size, const int pins[], unsigned int num_pins, uint64_t levels, mraa_timestamp_t start);
+unsigned int mraa_gpio_recorder_encode(int64_t delta, int idx, int level, uint8_t* record);
+unsigned int mraa_gpio_recorder_decode(const uint8_t* data, uint64_t capacity, uint64_t pos, int64_t* delta, int* idx, int* level);
+void mraa_gpio_recorder_edge(mraa_gpio_recorder_t recorder, int idx, int level, mraa_timestamp_t timestamp);
+void mraa_gpio_recorder_add_dropped(mraa_gpio_recorder_t recorder, unsigned int count);
+mraa_result_t mraa_gpio_recorder_close(mraa_gpio_recorder_t recorder, mraa_gpio_record_header* header);
+mraa_result_t mraa_gpio_recorder_write_vcd(const char* path, FILE* out);
+
+#ifdef __cplusplus
+}
+#endif
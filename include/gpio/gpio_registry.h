@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mraa_internal.h"
+
+/*
+ * Process wide registry of the sysfs gpios and gpio chips held by contexts.
+ * Mux setup, output enable handling and user code often open the same raw
+ * pin at once; they share one registry entry, so the pin is checked and
+ * exported by the first context only and unexported once, when the last
+ * context holding it closes.
+ */
+/* How long an export waits for udev to make gpioN/value usable. */
+#define MRAA_GPIO_EXPORT_TIMEOUT_MS 2000
+
+struct _gpio_pin_ref {
+    int pin;                 /**< raw sysfs number, or chip number for chip entries */
+    unsigned int refcount;   /**< contexts holding the entry, protected by the registry lock */
+    mraa_boolean_t unexport; /**< an owner closed, unexport with the last reference */
+    mraa_boolean_t exported; /**< the registry exported the pin */
+    mraa_boolean_t claimed;  /**< a context took ownership of that export */
+    int fd;                  /**< chip character device, -1 for sysfs pins */
+    struct _gpio_pin_ref* next;
+};
+
+/* Take a reference on a sysfs pin, exporting it if nobody has yet and waiting
+ * until its value file can be used. *exported tells whether the caller owns
+ * the export. */
+struct _gpio_pin_ref* mraa_gpio_registry_acquire(int pin, mraa_boolean_t* exported);
+/* Export every pin not exported yet in one pass, then wait for all of them at
+ * once. refs[i] is NULL for pins that failed, the first context opened on a
+ * pin exported here still becomes its owner. */
+mraa_result_t mraa_gpio_registry_acquire_many(const int pins[], unsigned int num, struct _gpio_pin_ref* refs[]);
+/* Drop a reference; unexport is the owner flag of the closing context. */
+void mraa_gpio_registry_release(struct _gpio_pin_ref* ref, mraa_boolean_t unexport);
+
+/* Shared descriptor of /dev/gpiochip<chip>, -1 on error. */
+int mraa_gpio_registry_chip_acquire(unsigned int chip);
+void mraa_gpio_registry_chip_release(unsigned int chip);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mraa_internal.h"
+
+/* Value of an attribute whose state is not known. */
+#define MRAA_GPIO_SHADOW_UNKNOWN -1
+
+/* sysfs attributes whose last written value is remembered. */
+typedef enum {
+    MRAA_GPIO_SHADOW_DIR = 0,  /**< MRAA_GPIO_IN or MRAA_GPIO_OUT */
+    MRAA_GPIO_SHADOW_EDGE = 1, /**< mraa_gpio_edge_t */
+    MRAA_GPIO_SHADOW_MODE = 2, /**< mraa_gpio_mode_t written to 'drive' */
+    MRAA_GPIO_SHADOW_ATTRS
+} mraa_gpio_shadow_attr_t;
+
+/*
+ * Process wide copy of the sysfs state of every exported gpio, keyed by the
+ * raw sysfs number so the contexts mraa_setup_mux_mapped() opens and closes
+ * over and over share it. A pin starts unknown, is learned on every read or
+ * successful write and forgotten when it is exported or unexported. Changes
+ * made outside this process are not seen.
+ */
+int mraa_gpio_shadow_get(int pin, mraa_gpio_shadow_attr_t attr);
+void mraa_gpio_shadow_set(int pin, mraa_gpio_shadow_attr_t attr, int value);
+void mraa_gpio_shadow_invalidate(int pin);
+void mraa_gpio_shadow_free();
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <pthread.h>
+
+#include "mraa_internal.h"
+
+struct _gpio_snapshot_pool;
+
+/* Reader of one chip, only touched by its thread while a snapshot runs. */
+struct _gpio_snapshot_worker {
+    struct _gpio_snapshot_pool* pool;
+    struct _gpio_group* group;
+    pthread_t thread;
+    uint64_t bits;              /**< levels of the group lines, bit i is slot i */
+    mraa_timestamp_t timestamp; /**< CLOCK_MONOTONIC middle of the read */
+    int status;
+};
+
+/*
+ * Threads reading the chips of a context at the same time, started on the
+ * first parallel snapshot and kept until the context closes. The caller reads
+ * the first chip itself, worker i reads chip i + 1.
+ */
+struct _gpio_snapshot_pool {
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    unsigned long generation; /**< bumped to start a round */
+    unsigned int pending;     /**< workers still reading in this round */
+    mraa_boolean_t stop;
+    unsigned int num_workers;
+    struct _gpio_snapshot_worker workers[];
+};
+
+/* One GPIO_V2_LINE_GET_VALUES on the group, timestamped. */
+int mraa_gpio_snapshot_read_group(struct _gpio_group* group, uint64_t* bits, mraa_timestamp_t* timestamp);
+/* Chardev snapshot, every group must already hold a line request. */
+mraa_result_t mraa_gpio_snapshot_chardev(mraa_gpio_context dev, uint64_t* values, mraa_timestamp_t timestamps[], mraa_boolean_t parallel);
+void mraa_gpio_snapshot_pool_free(struct _gpio_snapshot_pool* pool);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <pthread.h>
+
+#include "mraa_internal.h"
+
+/*
+ * One /dev/i2c-N descriptor shared by every context opened on the bus. SMBus
+ * transfers and plain read()/write() go to the slave selected on the
+ * descriptor, so the bus remembers the selected address and contexts only
+ * issue I2C_SLAVE_FORCE when they talk to a different slave than the last
+ * one. I2C_RDWR carries the address in each message and needs no selection.
+ * Every transfer holds the lock of its bus, which is recursive so that
+ * mraa_i2c_begin() can hold it across several transfers.
+ */
+struct _i2c_bus {
+    unsigned int busnum;
+    int fh;
+    unsigned long funcs;   /**< I2C_FUNCS of the adapter, 0 if unknown */
+    unsigned int refcount; /**< contexts on the bus, protected by the registry lock */
+    pthread_mutex_t lock;  /**< recursive, held for a transfer or a mraa_i2c_begin() scope */
+    int selected_addr;     /**< slave selected on fh, -1 when none */
+    struct _i2c_bus* next;
+};
+
+/* Shared bus of /dev/i2c-<busnum>, opened by the first context. */
+struct _i2c_bus* mraa_i2c_bus_acquire(unsigned int busnum);
+void mraa_i2c_bus_release(struct _i2c_bus* bus);
+/* Select addr on the descriptor unless it already is, bus->lock must be held. */
+mraa_result_t mraa_i2c_bus_select(struct _i2c_bus* bus, int addr);
+/* Read length bytes from command on with SMBus block reads, for adapters without I2C_RDWR. */
+mraa_result_t mraa_i2c_read_smbus(mraa_i2c_context dev, uint8_t command, uint8_t* data, int length);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <pthread.h>
+
+#include "mraa_internal.h"
+
+struct _i2c_poll_entry {
+    unsigned int desc;      /**< index in the descriptors given at start */
+    unsigned int every;     /**< ticks between two reads */
+    unsigned long next;     /**< tick of the next read */
+    size_t offset;          /**< of the bytes in the snapshot data */
+    size_t scratch;         /**< of the bytes in the scratch buffer during a tick */
+    mraa_boolean_t due;
+};
+
+/* Readers copy a buffer between two equal even values of seq, the writer
+ * makes seq odd while it fills the buffer. */
+struct _i2c_poll_snapshot {
+    unsigned int seq;
+    uint8_t* data;
+    mraa_timestamp_t* timestamps; /**< per entry, time of the last good read, 0 before */
+    mraa_result_t* status;        /**< per entry, result of the last read */
+};
+
+/* One register range read with a single write / repeated start / read pair. */
+struct _i2c_poll_block {
+    uint8_t addr;
+    uint8_t reg;
+    uint16_t len;
+    size_t scratch;
+    mraa_result_t status;
+};
+
+/*
+ * The descriptors of one bus and the thread reading them. Entries are sorted
+ * by address and register, so ranges due in the same tick merge into blocks
+ * when they overlap or touch, and blocks of every device on the bus share
+ * I2C_RDWR calls.
+ */
+struct _i2c_poll_bus {
+    struct _i2c_poller* poller;
+    int bus;
+    mraa_i2c_context dev;
+    pthread_t thread;
+    mraa_boolean_t started;
+    mraa_boolean_t no_rdwr; /**< the bus has no I2C_RDWR, read block by block */
+    unsigned int num_entries;
+    struct _i2c_poll_entry* entries;
+    size_t data_size;
+    struct _i2c_poll_snapshot snapshots[2];
+    unsigned int front; /**< snapshot readers use */
+    /* per tick work areas, sized once at start */
+    uint8_t* scratch;
+    uint8_t* block_regs;
+    struct _i2c_poll_block* blocks;
+    mraa_i2c_msg* msgs;
+};
+
+struct _i2c_poller {
+    mraa_i2c_poll_desc* descs;
+    unsigned int num_descs;
+    unsigned int* desc_bus;   /**< bus index of each descriptor */
+    unsigned int* desc_entry; /**< entry index of each descriptor in its bus */
+    uint64_t tick_ns;
+    pthread_mutex_t lock;
+    pthread_cond_t wake; /**< CLOCK_MONOTONIC, broadcast on stop */
+    mraa_boolean_t stop;
+    unsigned int num_buses;
+    struct _i2c_poll_bus* buses;
+};
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <pthread.h>
+
+#include "mraa_internal.h"
+
+/* Jobs a worker takes off the queue at once and runs back to back. */
+#define MRAA_I2C_QUEUE_BATCH 8
+
+struct _i2c_queue_node {
+    mraa_i2c_job* job;
+    mraa_i2c_job_cb cb;
+    mraa_i2c_context dev;
+    struct _i2c_queue_node* next;
+};
+
+/*
+ * Submission queue and worker thread of one bus, shared by the contexts that
+ * submitted jobs on it. The queue is kept sorted by priority, jobs of equal
+ * priority in submission order. The worker starts with the first context and
+ * stops with the last one.
+ */
+struct _i2c_queue {
+    int busnum;
+    unsigned int refcount; /**< contexts using the queue, protected by the registry lock */
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t work; /**< signalled on submit and stop */
+    pthread_cond_t done; /**< signalled when a batch completed */
+    struct _i2c_queue_node* head;
+    unsigned int depth; /**< jobs queued or running */
+    mraa_boolean_t stop;
+    struct _i2c_queue* next;
+};
+
+struct _i2c_queue* mraa_i2c_queue_acquire(int busnum);
+void mraa_i2c_queue_release(struct _i2c_queue* queue);
+mraa_result_t mraa_i2c_queue_push(struct _i2c_queue* queue, mraa_i2c_context dev, mraa_i2c_job* job, mraa_i2c_job_cb cb);
+unsigned int mraa_i2c_queue_count(struct _i2c_queue* queue);
+/* Block until every job submitted through dev completed, refused on the worker itself. */
+mraa_result_t mraa_i2c_queue_wait(struct _i2c_queue* queue, mraa_i2c_context dev);
+
+#ifdef __cplusplus
+}
+#endif
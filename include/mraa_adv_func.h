@@ -59,6 +59,7 @@ typedef struct {
     mraa_result_t (*i2c_write_byte_replace) (mraa_i2c_context dev, uint8_t data);
     mraa_result_t (*i2c_write_byte_data_replace) (mraa_i2c_context dev, const uint8_t data, const uint8_t command);
     mraa_result_t (*i2c_write_word_data_replace) (mraa_i2c_context dev, const uint16_t data, const uint8_t command);
+    mraa_result_t (*i2c_transfer_replace) (mraa_i2c_context dev, mraa_i2c_msg msgs[], unsigned int num_msgs);
     mraa_result_t (*i2c_stop_replace) (mraa_i2c_context dev);
 
     mraa_result_t (*aio_init_internal_replace) (mraa_aio_context dev, int pin);
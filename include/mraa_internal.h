@@ -154,6 +154,23 @@ int mraa_find_i2c_bus_pci(const char* pci_device, const char *pci_id, const char
  */
 mraa_result_t mraa_find_uart_bus_pci(const char* pci_dev_path, char** dev_name);
 
+/**
+ * helper function behind mraa_set_priority() letting the caller pick the
+ * real-time policy, applies to the calling thread only
+ *
+ * @param policy SCHED_RR or SCHED_FIFO
+ * @param priority clamped to the maximum of the policy
+ * @return the result of sched_setscheduler()
+ */
+int mraa_set_scheduler(const int policy, const int priority);
+
+/**
+ * CLOCK_MONOTONIC time, the clock behind every timestamp mraa hands out
+ *
+ * @return time in ns
+ */
+uint64_t mraa_monotonic_ns();
+
 #if defined(IMRAA)
 /**
  * read Imraa subplatform lock file, caller is responsible to free return
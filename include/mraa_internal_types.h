@@ -67,6 +67,19 @@
 #define IO_KEY "layout"
 #define PLATFORM_KEY "platform"
 #define BUS_KEY "bus"
+#define GPIO_MMAP_KEY "gpio_mmap"
+#define MMAP_DEVICE_KEY "device"
+#define MMAP_BASE_KEY "base"
+#define MMAP_SIZE_KEY "size"
+#define MMAP_BANK_STRIDE_KEY "bank_stride"
+#define MMAP_LINES_PER_BANK_KEY "lines_per_bank"
+#define MMAP_LINE_BASE_KEY "line_base"
+#define MMAP_SET_KEY "set"
+#define MMAP_CLEAR_KEY "clear"
+#define MMAP_DATA_KEY "data"
+#define MMAP_LEVEL_KEY "level"
+#define MMAP_DIR_KEY "dir"
+#define MMAP_DIR_OUT_HIGH_KEY "dir_out_high"
 
 // IO keys
 #define AIO_KEY "a"
@@ -94,6 +107,7 @@ struct _firmata {
 struct _gpio_group {
     int is_required;
     int dev_fd;
+    /* Line request fd, shared by reads, writes and edge events. */
     int gpiod_handle;
     unsigned int gpio_chip;
     /* We can have multiple lines in a gpio group. */
@@ -105,10 +119,11 @@ struct _gpio_group {
     /* Reverse mapping to original pin number indexes. */
     unsigned int *gpio_group_to_pins_table;
 
-    unsigned int flags;
-
-    /* Event specific fields. */
-    int *event_handles;
+    /* Line configuration, applied to every line of the group. */
+    uint64_t flags;
+    uint64_t output_values;
+    unsigned int debounce_period_us;
+    unsigned int last_seqno; /**< seqno of the last edge event read from the request */
 };
 
 /**
@@ -128,8 +143,11 @@ struct _gpio {
 #endif
     mraa_boolean_t isr_thread_terminating; /**< is the isr thread being terminated? */
     mraa_boolean_t owner; /**< If this context originally exported the pin */
+    struct _gpio_pin_ref *pin_ref; /**< shared export of the sysfs pin, NULL when not held */
     mraa_result_t (*mmap_write) (mraa_gpio_context dev, int value);
     int (*mmap_read) (mraa_gpio_context dev);
+    struct _gpio_mmap_port *mmap_port; /**< set while the generic mmap engine drives the pins */
+    unsigned int mmap_generation; /**< bumped each time mmap_port is set up or torn down */
     mraa_adv_func_t* advance_func; /**< override function table */
 #if defined(MOCKPLAT)
     mraa_gpio_dir_t mock_dir; /**< mock direction of the pin */
@@ -143,8 +161,17 @@ struct _gpio {
     struct _gpio_group *gpio_group;
     unsigned int num_chips;
     int *pin_to_gpio_table;
+    unsigned int *pin_to_slot_table; /**< index of each pin inside its gpio group */
     unsigned int num_pins;
+    struct _gpio_group *line_group; /**< group of a single line context, NULL otherwise */
     mraa_gpio_events_t events;
+    struct _gpio_event_ring *event_ring; /**< events queued by the isr thread */
+    unsigned int capture_seqno; /**< sequence number of the last sysfs edge queued */
+    struct _gpio_dispatch_source *dispatch_source; /**< set while served by the shared dispatcher */
+    struct _gpio_debounce *debounce; /**< software edge filter, NULL when off or done by the kernel */
+    struct _gpio_counter *counter; /**< edge counters updated by the isr, NULL unless counting */
+    struct _gpio_recorder *recorder; /**< file the isr records edges to, NULL unless recording */
+    struct _gpio_snapshot_pool *snapshot_pool; /**< chip readers of parallel snapshots, NULL until the first */
     int *provided_pins;
 
     struct _gpio *next;
@@ -169,8 +196,12 @@ struct _i2c {
     /*@{*/
     int busnum; /**< the bus number of the /dev/i2c-* device */
     int fh; /**< the file handle to the /dev/i2c-* device */
+    struct _i2c_bus *bus; /**< /dev/i2c-* descriptor shared with the other contexts on the bus */
+    struct _i2c_queue *queue; /**< job queue of the bus, NULL until the first mraa_i2c_submit() */
+    unsigned int queued_jobs; /**< jobs of this context in the queue, protected by the queue lock */
     int addr; /**< the address of the i2c slave */
     unsigned long funcs; /**< /dev/i2c-* device capabilities as per https://www.kernel.org/doc/Documentation/i2c/functionality */
+    int write_max; /**< longest message the adapter may take, 0 until one was refused */
     void *handle; /**< generic handle for non-standard drivers that don't use file descriptors  */
     mraa_adv_func_t* advance_func; /**< override function table */
 #if defined(MOCKPLAT)
@@ -356,6 +387,29 @@ typedef struct {
     /*@}*/
 } mraa_mmap_pin_t;
 
+/**
+ * Register layout of a memory mapped GPIO controller. Lines are grouped in
+ * banks of lines_per_bank, each bank repeating the same registers every
+ * bank_stride bytes. Offsets are relative to base, -1 when the register does
+ * not exist.
+ */
+typedef struct {
+    /*@{*/
+    char mem_dev[32]; /**< Memory device to map, /dev/gpiomem or /dev/mem etc */
+    uint64_t base; /**< Physical offset of the register block inside mem_dev */
+    unsigned int size; /**< Size of the register block */
+    unsigned int bank_stride; /**< Distance in bytes between two banks */
+    unsigned int lines_per_bank; /**< Lines controlled by one 32 bit register */
+    int line_base; /**< Os gpio number of the first line of the controller */
+    int set_offset; /**< Write 1 to drive a line high */
+    int clear_offset; /**< Write 1 to drive a line low */
+    int data_offset; /**< Output latch, read-modify-written when set/clear are missing */
+    int level_offset; /**< Input level, data_offset is read when missing */
+    int dir_offset; /**< One direction bit per line */
+    mraa_boolean_t dir_out_high; /**< Direction bit set means output */
+    /*@}*/
+} mraa_gpio_mmap_desc_t;
+
 /**
  * A Structure representing a physical Pin.
  */
@@ -489,6 +543,7 @@ typedef struct _board_t {
     mraa_boolean_t chardev_capable;  /**< Decide what interface is being used: old sysfs or new char device*/
     mraa_led_dev_t led_dev[MAX_LED_COUNT]; /**< Array of LED devices */
     unsigned int led_dev_count; /**< Total onboard LED device count */
+    mraa_gpio_mmap_desc_t* gpio_mmap; /**< Registers used by the generic mmap gpio engine, NULL if none */
     /*@}*/
 } mraa_board_t;
 
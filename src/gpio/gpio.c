@@ -7,6 +7,15 @@
  */
 #include "gpio.h"
 #include "gpio/gpio_chardev.h"
+#include "gpio/gpio_counter.h"
+#include "gpio/gpio_debounce.h"
+#include "gpio/gpio_dispatcher.h"
+#include "gpio/gpio_event_ring.h"
+#include "gpio/gpio_mmap.h"
+#include "gpio/gpio_recorder.h"
+#include "gpio/gpio_registry.h"
+#include "gpio/gpio_shadow.h"
+#include "gpio/gpio_snapshot.h"
 #include "linux/gpio.h"
 #include "mraa_internal.h"
 
@@ -27,6 +36,8 @@
 #define SYSFS_CLASS_GPIO "/sys/class/gpio"
 #define MAX_SIZE 64
 #define POLL_TIMEOUT
+/* Kernel events fetched per read() on a line request fd. */
+#define MRAA_GPIO_EVENT_BATCH 16
 
 static mraa_result_t
 _mraa_gpio_get_valfp(mraa_gpio_context dev)
@@ -101,32 +112,15 @@ mraa_gpio_init_internal(mraa_adv_func_t* func_table, int pin)
     dev->phy_pin = -1;
 
     if ((plat != NULL) && (!plat->chardev_capable)) {
-        char bu[MAX_SIZE];
-        int length;
+        mraa_boolean_t exported;
 
-        // then check to make sure the pin is exported.
-        char directory[MAX_SIZE];
-        snprintf(directory, MAX_SIZE, SYSFS_CLASS_GPIO "/gpio%d/", dev->pin);
-        struct stat dir;
-        if (stat(directory, &dir) == 0 && S_ISDIR(dir.st_mode)) {
-            dev->owner = 0; // Not Owner
-        } else {
-            int export = open(SYSFS_CLASS_GPIO "/export", O_WRONLY);
-            if (export == -1) {
-                syslog(LOG_ERR, "gpio%i: init: Failed to open 'export' for writing: %s", pin, strerror(errno));
-                status = MRAA_ERROR_INVALID_RESOURCE;
-                goto init_internal_cleanup;
-            }
-            length = snprintf(bu, sizeof(bu), "%d", dev->pin);
-            if (write(export, bu, length * sizeof(char)) == -1) {
-                syslog(LOG_ERR, "gpio%i: init: Failed to write to 'export': %s", pin, strerror(errno));
-                close(export);
-                status = MRAA_ERROR_INVALID_RESOURCE;
-                goto init_internal_cleanup;
-            }
-            dev->owner = 1;
-            close(export);
+        // contexts on the same pin share one export
+        dev->pin_ref = mraa_gpio_registry_acquire(dev->pin, &exported);
+        if (dev->pin_ref == NULL) {
+            status = MRAA_ERROR_INVALID_RESOURCE;
+            goto init_internal_cleanup;
         }
+        dev->owner = exported;
     }
 
     /* We only have one pin. No need for multiple pin legacy support. */
@@ -155,7 +149,7 @@ mraa_gpio_init_by_name(char* name)
     mraa_gpiod_line_info* linfo = NULL;
     mraa_gpiod_chip_info* cinfo;
     mraa_gpiod_chip_info** cinfos;
-    int i, line_found, line_offset;
+    int i, line_found = 0, line_offset = 0;
 
     if (name == NULL) {
         syslog(LOG_ERR, "[GPIOD_INTERFACE]: Gpio name not valid");
@@ -174,7 +168,8 @@ mraa_gpio_init_by_name(char* name)
     }
 
     dev->pin_to_gpio_table = malloc(sizeof(int));
-    if (dev->pin_to_gpio_table == NULL) {
+    dev->pin_to_slot_table = calloc(1, sizeof(unsigned int));
+    if (dev->pin_to_gpio_table == NULL || dev->pin_to_slot_table == NULL) {
         syslog(LOG_CRIT, "[GPIOD_INTERFACE]: Failed to allocate memory for internal member");
         mraa_gpio_close(dev);
         return NULL;
@@ -205,16 +200,24 @@ mraa_gpio_init_by_name(char* name)
     /* Iterate over all gpiochips in the platform to find the requested line */
     for_each_gpio_chip(cinfo, cinfos, dev->num_chips)
     {
-        for (i = 0; i < cinfo->chip_info.lines; i++) {
-            linfo = mraa_get_line_info_by_chip_name(cinfo->chip_info.name, i);
-            if (!strncmp(linfo->name, name, 32)) {
+        for (i = 0; i < cinfo->chip_info.lines && !line_found; i++) {
+            linfo = mraa_get_line_info_from_descriptor(cinfo->chip_fd, i);
+            if (linfo != NULL && !strncmp(linfo->name, name, 32)) {
+                unsigned int chip;
+
                 /* idx is coming from `for_each_gpio_chip` definition */
                 syslog(LOG_DEBUG, "[GPIOD_INTERFACE]: Chip: %d Line: %d", idx, i);
-                if (!gpio_group[idx].is_required) {
-                    gpio_group[idx].dev_fd = cinfo->chip_fd;
-                    gpio_group[idx].is_required = 1;
-                    gpio_group[idx].gpiod_handle = -1;
+
+                // the chip descriptor is shared by every context on the chip
+                if (sscanf(cinfo->chip_info.name, "gpiochip%u", &chip) != 1 ||
+                    (gpio_group[idx].dev_fd = mraa_gpio_registry_chip_acquire(chip)) < 0) {
+                    syslog(LOG_ERR, "[GPIOD_INTERFACE]: Failed to open chip %s", cinfo->chip_info.name);
+                    free(linfo);
+                    break;
                 }
+                gpio_group[idx].gpio_chip = chip;
+                gpio_group[idx].is_required = 1;
+                gpio_group[idx].gpiod_handle = -1;
 
                 /* Map pin to _gpio_group structure. */
                 dev->pin_to_gpio_table[0] = idx;
@@ -224,27 +227,34 @@ mraa_gpio_init_by_name(char* name)
 
                 line_found = 1;
                 line_offset = i;
-
-                break;
             }
+            free(linfo);
         }
     }
 
+    /* The scan descriptors are not kept, the registry holds its own */
+    for_each_gpio_chip(cinfo, cinfos, dev->num_chips)
+    {
+        close(cinfo->chip_fd);
+        free(cinfo);
+    }
+    free(cinfos);
+
     if (!line_found) {
         syslog(LOG_ERR, "[GPIOD_INTERFACE]: Gpio not found!");
+        mraa_gpio_close(dev);
         return NULL;
     }
 
-    /* Initialize rw_values for read / write multiple functions */
+    /* Initialize rw_values for read / write multiple functions. The single line maps back to pin 0. */
     for (i = 0; i < dev->num_chips; ++i) {
         gpio_group[i].rw_values = calloc(gpio_group[i].num_gpio_lines, sizeof(unsigned char));
-        if (gpio_group[i].rw_values == NULL) {
+        gpio_group[i].gpio_group_to_pins_table = calloc(gpio_group[i].num_gpio_lines, sizeof(int));
+        if (gpio_group[i].rw_values == NULL || gpio_group[i].gpio_group_to_pins_table == NULL) {
             syslog(LOG_CRIT, "[GPIOD_INTERFACE]: Failed to allocate memory for internal member");
             mraa_gpio_close(dev);
             return NULL;
         }
-
-        gpio_group[i].event_handles = NULL;
     }
 
     /* Save the provided array from the user to our internal structure. */
@@ -258,6 +268,7 @@ mraa_gpio_init_by_name(char* name)
     memcpy(dev->provided_pins, &line_offset, dev->num_pins * sizeof(int));
 
     dev->events = NULL;
+    dev->line_group = &gpio_group[dev->pin_to_gpio_table[0]];
 
     return dev;
 }
@@ -322,6 +333,7 @@ mraa_gpio_init(int pin)
     if (IS_FUNC_DEFINED(r, gpio_init_post)) {
         mraa_result_t ret = r->advance_func->gpio_init_post(r);
         if (ret != MRAA_SUCCESS) {
+            mraa_gpio_registry_release(r->pin_ref, r->owner);
             free(r);
             return NULL;
         }
@@ -346,7 +358,8 @@ mraa_gpio_chardev_init(int pins[], int num_pins)
     }
 
     dev->pin_to_gpio_table = malloc(num_pins * sizeof(int));
-    if (dev->pin_to_gpio_table == NULL) {
+    dev->pin_to_slot_table = malloc(num_pins * sizeof(unsigned int));
+    if (dev->pin_to_gpio_table == NULL || dev->pin_to_slot_table == NULL) {
         syslog(LOG_CRIT, "[GPIOD_INTERFACE]: Failed to allocate memory for internal member");
         mraa_gpio_close(dev);
         return NULL;
@@ -415,18 +428,15 @@ mraa_gpio_chardev_init(int pins[], int num_pins)
         dev->pin_to_gpio_table[i] = chip_id;
 
         if (!gpio_group[chip_id].is_required) {
-            mraa_gpiod_chip_info* cinfo = mraa_get_chip_info_by_number(chip_id);
-            if (!cinfo) {
-                syslog(LOG_ERR, "[GPIOD_INTERFACE]: error getting gpio_chip_info for chip %d", chip_id);
+            // the chip descriptor is shared by every context on the chip
+            gpio_group[chip_id].dev_fd = mraa_gpio_registry_chip_acquire(chip_id);
+            if (gpio_group[chip_id].dev_fd < 0) {
                 mraa_gpio_close(dev);
                 return NULL;
             }
 
-            gpio_group[chip_id].dev_fd = cinfo->chip_fd;
             gpio_group[chip_id].is_required = 1;
             gpio_group[chip_id].gpiod_handle = -1;
-
-            free(cinfo);
         }
 
         int line_in_group;
@@ -441,6 +451,9 @@ mraa_gpio_chardev_init(int pins[], int num_pins)
 
         gpio_group[chip_id].gpio_lines[line_in_group] = line_offset;
         gpio_group[chip_id].num_gpio_lines++;
+
+        /* Scatter table used by the write paths: pin -> (chip, slot in chip). */
+        dev->pin_to_slot_table[i] = line_in_group;
     }
 
     /* Initialize rw_values for read / write multiple functions.
@@ -459,26 +472,14 @@ mraa_gpio_chardev_init(int pins[], int num_pins)
             mraa_gpio_close(dev);
             return NULL;
         }
-
-        /* Set event handle arrays for all lines contained on a chip to NULL. */
-        gpio_group[i].event_handles = NULL;
     }
 
     /* Finally map the inverse relation between a gpio group and its original pin numbers
      * provided by user. */
-    int* counters = calloc(dev->num_chips, sizeof(int));
-    if (counters == NULL) {
-        syslog(LOG_CRIT, "[GPIOD_INTERFACE]: Failed to allocate memory for local variable");
-        mraa_gpio_close(dev);
-        return NULL;
-    }
-
     for (int i = 0; i < num_pins; ++i) {
         int chip = dev->pin_to_gpio_table[i];
-        gpio_group[chip].gpio_group_to_pins_table[counters[chip]] = i;
-        counters[chip]++;
+        gpio_group[chip].gpio_group_to_pins_table[dev->pin_to_slot_table[i]] = i;
     }
-    free(counters);
 
     /* Save the provided array from the user to our internal structure. */
     dev->provided_pins = malloc(dev->num_pins * sizeof(int));
@@ -493,6 +494,11 @@ mraa_gpio_chardev_init(int pins[], int num_pins)
     /* Initialize events array. */
     dev->events = NULL;
 
+    /* Single line contexts bypass the multi-pin machinery on read / write. */
+    if (num_pins == 1) {
+        dev->line_group = &gpio_group[dev->pin_to_gpio_table[0]];
+    }
+
     return dev;
 }
 
@@ -511,6 +517,20 @@ mraa_gpio_init_multi(int pins[], int num_pins)
 
     /* Fallback to legacy interface. */
     mraa_gpio_context head = NULL, current, tmp;
+    struct _gpio_pin_ref* refs[num_pins];
+    int raw_pins[num_pins];
+    int num_raw = 0;
+
+    /* Export every plain sysfs pin up front and wait for udev once for all of
+     * them, the contexts below then find their pins ready. */
+    if (board->adv_func == NULL || board->adv_func->gpio_init_internal_replace == NULL) {
+        for (int i = 0; i < num_pins; ++i) {
+            if (pins[i] >= 0 && pins[i] < board->phy_pin_count && board->pins[pins[i]].capabilities.gpio == 1) {
+                raw_pins[num_raw++] = board->pins[pins[i]].gpio.pinmap;
+            }
+        }
+        mraa_gpio_registry_acquire_many(raw_pins, num_raw, refs);
+    }
 
     for (int i = 0; i < num_pins; ++i) {
         tmp = mraa_gpio_init(pins[i]);
@@ -530,6 +550,10 @@ mraa_gpio_init_multi(int pins[], int num_pins)
         current->next = NULL;
     }
 
+    for (int i = 0; i < num_raw; ++i) {
+        mraa_gpio_registry_release(refs[i], 0);
+    }
+
     if (head != NULL) {
         head->num_pins = num_pins;
     }
@@ -552,6 +576,160 @@ _mraa_gpio_get_timestamp_sysfs()
     return (time.tv_sec * 1e6 + time.tv_usec);
 }
 
+/* sysfs only tells that a pin changed, the level read on wakeup gives the edge. */
+static void
+mraa_gpio_queue_edge_sysfs(mraa_gpio_context dev, int pin_idx, unsigned char level)
+{
+    mraa_gpio_context it = dev;
+
+    for (int i = 0; i < pin_idx && it->next != NULL; ++i) {
+        it = it->next;
+    }
+
+    dev->capture_seqno++;
+
+    mraa_gpio_capture_event record = {
+        .pin = it->phy_pin,
+        .edge = level == '1' ? MRAA_GPIO_EDGE_RISING : MRAA_GPIO_EDGE_FALLING,
+        .timestamp = mraa_monotonic_ns(),
+        .seqno = dev->capture_seqno,
+        .line_seqno = dev->capture_seqno,
+    };
+    mraa_gpio_event_ring_push(dev->event_ring, &record);
+}
+
+/* Events array entries are ordered by chip on chardev platforms, find the
+ * group and the slot inside it of entry idx. */
+static mraa_gpiod_group_t
+mraa_gpio_event_line_group(mraa_gpio_context dev, int idx, int* slot)
+{
+    mraa_gpiod_group_t gpio_iter;
+    int event_base = 0;
+
+    for_each_gpio_group(gpio_iter, dev)
+    {
+        if (idx < event_base + (int) gpio_iter->num_gpio_lines) {
+            *slot = idx - event_base;
+            return gpio_iter;
+        }
+        event_base += gpio_iter->num_gpio_lines;
+    }
+
+    return NULL;
+}
+
+static mraa_gpio_context
+mraa_gpio_event_line_sysfs(mraa_gpio_context dev, int idx)
+{
+    mraa_gpio_context it = dev;
+
+    for (int i = 0; i < idx && it != NULL; ++i) {
+        it = it->next;
+    }
+
+    return it;
+}
+
+/* Majority of vote reads of the line behind events entry idx, -1 on error. */
+static int
+mraa_gpio_vote_line(mraa_gpio_context dev, int idx, unsigned int vote)
+{
+    unsigned int ones = 0;
+
+    for (unsigned int i = 0; i < vote; ++i) {
+        int level;
+
+        if (plat->chardev_capable) {
+            int slot;
+            uint64_t bits = 0;
+            mraa_gpiod_group_t group = mraa_gpio_event_line_group(dev, idx, &slot);
+
+            if (group == NULL || mraa_get_line_bits(group->gpiod_handle, 1ULL << slot, &bits) < 0) {
+                return -1;
+            }
+            level = (bits >> slot) & 1ULL;
+        } else {
+            mraa_gpio_context it = mraa_gpio_event_line_sysfs(dev, idx);
+
+            if (it == NULL || (level = mraa_gpio_read(it)) < 0) {
+                return -1;
+            }
+        }
+
+        ones += level;
+    }
+
+    return ones * 2 > vote;
+}
+
+/* Report the lines whose debounce window elapsed, returns how many changed level. */
+static int
+mraa_gpio_debounce_flush(mraa_gpio_context dev)
+{
+    mraa_gpio_debounce_ready ready[dev->debounce->num_lines];
+    unsigned int count = mraa_gpio_debounce_expire(dev->debounce, ready);
+    int delivered = 0;
+
+    for (unsigned int i = 0; i < count; ++i) {
+        int idx = ready[i].line;
+        int level = ready[i].level;
+        int pin, pin_idx;
+
+        if (dev->debounce->vote > 1) {
+            level = mraa_gpio_vote_line(dev, idx, dev->debounce->vote);
+            if (level < 0) {
+                syslog(LOG_ERR, "gpio%i: debounce: failed to sample line %d", dev->pin, idx);
+                continue;
+            }
+        }
+
+        if (!mraa_gpio_debounce_commit(dev->debounce, idx, level)) {
+            continue;
+        }
+
+        dev->events[idx].id = idx;
+        if (plat->chardev_capable) {
+            int slot;
+            mraa_gpiod_group_t group = mraa_gpio_event_line_group(dev, idx, &slot);
+
+            dev->events[idx].timestamp = ready[i].since;
+            pin_idx = group->gpio_group_to_pins_table[slot];
+            pin = dev->provided_pins[pin_idx];
+        } else {
+            dev->events[idx].timestamp = _mraa_gpio_get_timestamp_sysfs();
+            pin_idx = idx;
+            pin = mraa_gpio_event_line_sysfs(dev, idx)->phy_pin;
+        }
+
+        if (dev->counter != NULL) {
+            mraa_gpio_counter_edge(dev->counter, pin_idx, ready[i].since);
+        }
+        if (dev->recorder != NULL) {
+            mraa_gpio_recorder_edge(dev->recorder, pin_idx, level, ready[i].since);
+        }
+
+        if (dev->event_ring != NULL) {
+            dev->capture_seqno++;
+
+            mraa_gpio_capture_event record = {
+                .pin = pin,
+                .edge = level ? MRAA_GPIO_EDGE_RISING : MRAA_GPIO_EDGE_FALLING,
+                .timestamp = ready[i].since,
+                .seqno = dev->capture_seqno,
+                .line_seqno = dev->capture_seqno,
+            };
+            mraa_gpio_event_ring_push(dev->event_ring, &record);
+        }
+        delivered++;
+    }
+
+    if (delivered && dev->event_ring != NULL) {
+        mraa_gpio_event_ring_notify(dev->event_ring);
+    }
+
+    return delivered;
+}
+
 static mraa_result_t
 mraa_gpio_wait_interrupt(int fds[],
                          int num_fds
@@ -560,13 +738,17 @@ mraa_gpio_wait_interrupt(int fds[],
                          int control_fd
 #endif
                          ,
-                         mraa_gpio_events_t events)
+                         mraa_gpio_context dev)
 {
+    mraa_gpio_events_t events = dev->events;
     unsigned char c;
+    int queued = 0, delivered = 0;
+    /* The debounce timer, when present, sits right after the value fds. */
+    int num_pfd = num_fds + (dev->debounce != NULL);
 #ifdef HAVE_PTHREAD_CANCEL
-    struct pollfd pfd[num_fds];
+    struct pollfd pfd[num_pfd];
 #else
-    struct pollfd pfd[num_fds + 1];
+    struct pollfd pfd[num_pfd + 1];
 
     if (control_fd < 0) {
         return MRAA_ERROR_INVALID_PARAMETER;
@@ -583,40 +765,169 @@ mraa_gpio_wait_interrupt(int fds[],
         pfd[i].events = POLLPRI;
 
         // do an initial read to clear interrupt
-        lseek(fds[i], 0, SEEK_SET);
-        read(fds[i], &c, 1);
+        pread(fds[i], &c, 1, 0);
     }
 
-#ifdef HAVE_PTHREAD_CANCEL
-    // Wait for it forever or until pthread_cancel
-    // poll is a cancelable point like sleep()
-    poll(pfd, num_fds, -1);
-#else
+    if (dev->debounce != NULL) {
+        pfd[num_fds].fd = dev->debounce->timer_fd;
+        pfd[num_fds].events = POLLIN;
+    }
+
+#ifndef HAVE_PTHREAD_CANCEL
     // setup poll on the controling fd
-    pfd[num_fds].fd = control_fd;
-    pfd[num_fds].events = 0; //  POLLHUP, POLLERR, and POLLNVAL
+    pfd[num_pfd].fd = control_fd;
+    pfd[num_pfd].events = 0; //  POLLHUP, POLLERR, and POLLNVAL
+#endif
 
-    // Wait for it forever or until control fd is closed
-    poll(pfd, num_fds + 1, -1);
+    /* With a software filter the edges are only fed to it, the caller is
+     * woken once a level has held for the whole window. */
+    do {
+#ifdef HAVE_PTHREAD_CANCEL
+        // Wait for it forever or until pthread_cancel
+        // poll is a cancelable point like sleep()
+        poll(pfd, num_pfd, -1);
+#else
+        // Wait for it forever or until control fd is closed
+        poll(pfd, num_pfd + 1, -1);
+        if (pfd[num_pfd].revents) {
+            return MRAA_SUCCESS;
+        }
 #endif
 
-    for (int i = 0; i < num_fds; ++i) {
-        if (pfd[i].revents & POLLPRI) {
-            read(fds[i], &c, 1);
-            events[i].id = i;
-            events[i].timestamp = _mraa_gpio_get_timestamp_sysfs();
-        } else
-            events[i].id = -1;
+        for (int i = 0; i < num_fds; ++i) {
+            if (pfd[i].revents & POLLPRI) {
+                // without the level the edge can be neither told nor filtered
+                if (pread(fds[i], &c, 1, 0) != 1) {
+                    syslog(LOG_ERR, "gpio%i: wait_interrupt: Failed to read 'value': %s", dev->pin, strerror(errno));
+                    events[i].id = -1;
+                    continue;
+                }
+                if (dev->debounce != NULL) {
+                    mraa_gpio_debounce_edge(dev->debounce, i, c == '1', mraa_monotonic_ns());
+                    continue;
+                }
+                events[i].id = i;
+                events[i].timestamp = _mraa_gpio_get_timestamp_sysfs();
+                if (dev->counter != NULL) {
+                    mraa_gpio_counter_edge(dev->counter, i, mraa_monotonic_ns());
+                }
+                if (dev->recorder != NULL) {
+                    mraa_gpio_recorder_edge(dev->recorder, i, c == '1', mraa_monotonic_ns());
+                }
+                if (dev->event_ring != NULL) {
+                    mraa_gpio_queue_edge_sysfs(dev, i, c);
+                    queued++;
+                }
+            } else
+                events[i].id = -1;
+        }
+
+        if (dev->debounce != NULL) {
+            for (int i = 0; i < dev->num_pins; ++i) {
+                events[i].id = -1;
+            }
+            delivered = mraa_gpio_debounce_flush(dev);
+        }
+    } while (dev->debounce != NULL && delivered == 0);
+
+    if (queued) {
+        mraa_gpio_event_ring_notify(dev->event_ring);
+    }
+
+    return MRAA_SUCCESS;
+}
+
+static mraa_result_t
+mraa_gpio_chardev_get_handle(mraa_gpiod_group_t group, uint64_t default_dir)
+{
+    if (group->gpiod_handle > 0) {
+        return MRAA_SUCCESS;
+    }
+
+    /* Lines are requested lazily, in the default direction if none was set. */
+    if (!(group->flags & (GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_OUTPUT))) {
+        group->flags |= default_dir;
+    }
+
+    if (_mraa_gpiod_configure_group(group) < 0) {
+        syslog(LOG_ERR, "[GPIOD_INTERFACE]: error getting gpio line handle");
+        return MRAA_ERROR_INVALID_HANDLE;
     }
 
     return MRAA_SUCCESS;
 }
 
+/* One line request per chip, the event offset tells which line fired. A single
+ * read drains up to MRAA_GPIO_EVENT_BATCH queued events, anything left makes
+ * the next poll return straight away. Returns the number of events queued. */
+static int
+mraa_gpio_chardev_read_group_events(mraa_gpio_context dev, mraa_gpiod_group_t gpio_iter, int fd, int event_base)
+{
+    struct gpio_v2_line_event event_data[MRAA_GPIO_EVENT_BATCH];
+    int queued = 0;
+    ssize_t len = read(fd, event_data, sizeof(event_data));
+
+    for (int e = 0; e < (int) (len / (ssize_t) sizeof(event_data[0])); ++e) {
+        /* The kernel drops events when its fifo is full, seqno shows the gap. */
+        if (dev->event_ring != NULL && event_data[e].seqno > gpio_iter->last_seqno + 1) {
+            mraa_gpio_event_ring_add_dropped(dev->event_ring,
+                                             event_data[e].seqno - gpio_iter->last_seqno - 1);
+            if (dev->recorder != NULL) {
+                mraa_gpio_recorder_add_dropped(dev->recorder,
+                                               event_data[e].seqno - gpio_iter->last_seqno - 1);
+            }
+        }
+        gpio_iter->last_seqno = event_data[e].seqno;
+
+        for (int j = 0; j < gpio_iter->num_gpio_lines; ++j) {
+            if (gpio_iter->gpio_lines[j] == event_data[e].offset) {
+                int pin_idx = gpio_iter->gpio_group_to_pins_table[j];
+
+                if (dev->debounce != NULL) {
+                    mraa_gpio_debounce_edge(dev->debounce, event_base + j,
+                                            event_data[e].id == GPIO_V2_LINE_EVENT_RISING_EDGE,
+                                            event_data[e].timestamp_ns);
+                    break;
+                }
+
+                dev->events[event_base + j].id = event_base + j;
+                dev->events[event_base + j].timestamp = event_data[e].timestamp_ns;
+                if (dev->counter != NULL) {
+                    mraa_gpio_counter_edge(dev->counter, pin_idx, event_data[e].timestamp_ns);
+                }
+                if (dev->recorder != NULL) {
+                    mraa_gpio_recorder_edge(dev->recorder, pin_idx,
+                                            event_data[e].id == GPIO_V2_LINE_EVENT_RISING_EDGE,
+                                            event_data[e].timestamp_ns);
+                }
+                if (dev->event_ring != NULL) {
+                    mraa_gpio_capture_event record = {
+                        .pin = dev->provided_pins[pin_idx],
+                        .edge = event_data[e].id == GPIO_V2_LINE_EVENT_RISING_EDGE ? MRAA_GPIO_EDGE_RISING :
+                                                                                     MRAA_GPIO_EDGE_FALLING,
+                        .timestamp = event_data[e].timestamp_ns,
+                        .seqno = event_data[e].seqno,
+                        .line_seqno = event_data[e].line_seqno,
+                    };
+                    mraa_gpio_event_ring_push(dev->event_ring, &record);
+                    queued++;
+                }
+                break;
+            }
+        }
+    }
+
+    return queued;
+}
+
 static mraa_result_t
-mraa_gpio_chardev_wait_interrupt(int fds[], int num_fds, mraa_gpio_events_t events)
+mraa_gpio_chardev_wait_interrupt(mraa_gpio_context dev, int fds[], int num_fds)
 {
-    struct pollfd pfd[num_fds];
-    struct gpioevent_data event_data;
+    /* The debounce timer, when present, sits right after the line requests. */
+    int num_pfd = num_fds + (dev->debounce != NULL);
+    struct pollfd pfd[num_pfd];
+    mraa_gpiod_group_t gpio_iter;
+    int queued = 0, delivered = 0;
 
     if (!fds) {
         return MRAA_ERROR_INVALID_PARAMETER;
@@ -625,19 +936,39 @@ mraa_gpio_chardev_wait_interrupt(int fds[], int num_fds, mraa_gpio_events_t even
     for (int i = 0; i < num_fds; ++i) {
         pfd[i].fd = fds[i];
         pfd[i].events = POLLIN;
+    }
 
-        lseek(fds[i], 0, SEEK_SET);
+    if (dev->debounce != NULL) {
+        pfd[num_fds].fd = dev->debounce->timer_fd;
+        pfd[num_fds].events = POLLIN;
     }
 
-    poll(pfd, num_fds, -1);
+    do {
+        int fd_idx = 0, event_base = 0;
 
-    for (int i = 0; i < num_fds; ++i) {
-        if (pfd[i].revents & POLLIN) {
-            read(fds[i], &event_data, sizeof(event_data));
-            events[i].id = i;
-            events[i].timestamp = event_data.timestamp;
-        } else
-            events[i].id = -1;
+        poll(pfd, num_pfd, -1);
+
+        for (int i = 0; i < dev->num_pins; ++i) {
+            dev->events[i].id = -1;
+        }
+
+        for_each_gpio_group(gpio_iter, dev)
+        {
+            if (pfd[fd_idx].revents & POLLIN) {
+                queued += mraa_gpio_chardev_read_group_events(dev, gpio_iter, fds[fd_idx], event_base);
+            }
+
+            event_base += gpio_iter->num_gpio_lines;
+            fd_idx++;
+        }
+
+        if (dev->debounce != NULL) {
+            delivered = mraa_gpio_debounce_flush(dev);
+        }
+    } while (dev->debounce != NULL && delivered == 0);
+
+    if (queued) {
+        mraa_gpio_event_ring_notify(dev->event_ring);
     }
 
     return MRAA_SUCCESS;
@@ -683,27 +1014,92 @@ mraa_gpio_get_events(mraa_gpio_context dev)
     return dev->events;
 }
 
-static void*
-mraa_gpio_interrupt_handler(void* arg)
+int
+mraa_gpio_capture_read(mraa_gpio_context dev, mraa_gpio_capture_event* buf, unsigned int max, int timeout_ms)
 {
-    if (arg == NULL) {
-        syslog(LOG_ERR, "gpio: interrupt_handler: context is invalid");
-        return NULL;
+    if (dev == NULL) {
+        syslog(LOG_ERR, "gpio: capture_read: context is invalid");
+        return -1;
     }
 
-    mraa_result_t ret;
-    mraa_gpio_context dev = (mraa_gpio_context) arg;
-    int idx = 0;
+    if (buf == NULL || max == 0) {
+        syslog(LOG_ERR, "gpio: capture_read: invalid buffer");
+        return -1;
+    }
 
-    if (IS_FUNC_DEFINED(dev, gpio_interrupt_handler_init_replace)) {
-        if (dev->advance_func->gpio_interrupt_handler_init_replace(dev) != MRAA_SUCCESS)
-            return NULL;
+    // mraa_gpio_close() waits for us before freeing the ring
+    mraa_gpio_event_ring_t ring = mraa_gpio_event_ring_enter(&dev->event_ring);
+    if (ring == NULL) {
+        syslog(LOG_ERR, "gpio: capture_read: no interrupt configured on this context");
+        return -1;
+    }
+
+    int ret = mraa_gpio_event_ring_wait(ring, buf, max, timeout_ms);
+    mraa_gpio_event_ring_leave(ring);
+
+    return ret;
+}
+
+unsigned int
+mraa_gpio_capture_dropped(mraa_gpio_context dev)
+{
+    unsigned int dropped;
+
+    if (dev == NULL) {
+        return 0;
+    }
+
+    mraa_gpio_event_ring_t ring = mraa_gpio_event_ring_enter(&dev->event_ring);
+    if (ring == NULL) {
+        return 0;
     }
 
+    dropped = mraa_gpio_event_ring_dropped(ring);
+    mraa_gpio_event_ring_leave(ring);
+
+    return dropped;
+}
+
+int
+mraa_gpio_read_events(mraa_gpio_context dev, mraa_gpio_event* buf, unsigned int max, int timeout_ms)
+{
+    mraa_gpio_capture_event records[MRAA_GPIO_EVENT_BATCH];
+    int total = 0, count;
+
+    if (buf == NULL || max == 0) {
+        syslog(LOG_ERR, "gpio: read_events: invalid buffer");
+        return -1;
+    }
+
+    /* Only the first chunk may block, the rest drains what is queued. */
+    do {
+        unsigned int chunk = max - total < MRAA_GPIO_EVENT_BATCH ? max - total : MRAA_GPIO_EVENT_BATCH;
+
+        count = mraa_gpio_capture_read(dev, records, chunk, total == 0 ? timeout_ms : 0);
+        if (count < 0) {
+            return -1;
+        }
+
+        for (int i = 0; i < count; ++i) {
+            buf[total + i].id = records[i].pin;
+            buf[total + i].timestamp = records[i].timestamp;
+        }
+        total += count;
+    } while (count > 0 && (unsigned int) total < max);
+
+    return total;
+}
+
+/* Collect the fds to wait on for edges: the line request of every chip on
+ * chardev platforms, a freshly opened value file per pin on sysfs. */
+static int
+mraa_gpio_open_event_fds(mraa_gpio_context dev, int** fds)
+{
+    int idx = 0;
     int* fps = calloc(dev->num_pins, sizeof(int));
     if (!fps) {
         syslog(LOG_ERR, "mraa_gpio_interrupt_handler_multiple() malloc error");
-        return NULL;
+        return -1;
     }
 
     /* Is this pin on a subplatform? Do nothing... */
@@ -715,9 +1111,7 @@ mraa_gpio_interrupt_handler(void* arg)
 
         for_each_gpio_group(gpio_group, dev)
         {
-            for (int i = 0; i < gpio_group->num_gpio_lines; ++i) {
-                fps[idx++] = gpio_group->event_handles[i];
-            }
+            fps[idx++] = gpio_group->gpiod_handle;
         }
     }
     /* Else, attempt fs access */
@@ -733,7 +1127,7 @@ mraa_gpio_interrupt_handler(void* arg)
                 syslog(LOG_ERR, "gpio%i: interrupt_handler: failed to open 'value' : %s", it->pin,
                        strerror(errno));
                 mraa_gpio_close_event_handles_sysfs(fps, idx);
-                return NULL;
+                return -1;
             }
 
             idx++;
@@ -741,46 +1135,153 @@ mraa_gpio_interrupt_handler(void* arg)
         }
     }
 
-#ifndef HAVE_PTHREAD_CANCEL
-    if (pipe(dev->isr_control_pipe)) {
-        syslog(LOG_ERR, "gpio%i: interrupt_handler: failed to create isr control pipe: %s",
-               dev->pin, strerror(errno));
-        mraa_gpio_close_event_handles_sysfs(fps, dev->num_pins);
-        return NULL;
+    *fds = fps;
+    return idx;
+}
+
+void
+_mraa_gpio_dispatch_event(mraa_gpio_context dev, int fd_idx, int fd)
+{
+    if (dev->isr_thread_terminating) {
+        return;
     }
-#endif
 
-    if (lang_func->java_attach_thread != NULL) {
-        if (dev->isr == lang_func->java_isr_callback) {
-            if (lang_func->java_attach_thread() != MRAA_SUCCESS) {
-                mraa_gpio_close_event_handles_sysfs(fps, dev->num_pins);
-                return NULL;
-            }
-        }
+    for (int i = 0; i < dev->num_pins; ++i) {
+        dev->events[i].id = -1;
     }
 
-    for (;;) {
-        if (IS_FUNC_DEFINED(dev, gpio_wait_interrupt_replace)) {
-            ret = dev->advance_func->gpio_wait_interrupt_replace(dev);
-        } else {
-            if (plat->chardev_capable) {
-                ret = mraa_gpio_chardev_wait_interrupt(fps, idx, dev->events);
-            } else {
-                ret = mraa_gpio_wait_interrupt(fps, idx
-#ifndef HAVE_PTHREAD_CANCEL
-                                               ,
-                                               dev->isr_control_pipe[0]
-#endif
-                                               ,
-                                               dev->events);
+    if (plat->chardev_capable) {
+        mraa_gpiod_group_t gpio_iter;
+        int group_idx = 0, event_base = 0;
+
+        for_each_gpio_group(gpio_iter, dev)
+        {
+            if (group_idx++ == fd_idx) {
+                if (mraa_gpio_chardev_read_group_events(dev, gpio_iter, fd, event_base) > 0) {
+                    mraa_gpio_event_ring_notify(dev->event_ring);
+                }
+                break;
             }
+            event_base += gpio_iter->num_gpio_lines;
         }
+    } else {
+        unsigned char c;
 
-        if (ret == MRAA_SUCCESS && !dev->isr_thread_terminating) {
-#ifdef HAVE_PTHREAD_CANCEL
+        // clear the edge, a sysfs fd carries a single pin
+        if (pread(fd, &c, 1, 0) != 1) {
+            syslog(LOG_ERR, "gpio%i: dispatch: Failed to read 'value': %s", dev->pin, strerror(errno));
+            return;
+        }
+        dev->events[fd_idx].id = fd_idx;
+        dev->events[fd_idx].timestamp = _mraa_gpio_get_timestamp_sysfs();
+        if (dev->counter != NULL) {
+            mraa_gpio_counter_edge(dev->counter, fd_idx, mraa_monotonic_ns());
+        }
+        if (dev->recorder != NULL) {
+            mraa_gpio_recorder_edge(dev->recorder, fd_idx, c == '1', mraa_monotonic_ns());
+        }
+        if (dev->event_ring != NULL) {
+            mraa_gpio_queue_edge_sysfs(dev, fd_idx, c);
+            mraa_gpio_event_ring_notify(dev->event_ring);
+        }
+    }
+
+    if (dev->isr != NULL) {
+        dev->isr(dev->isr_args);
+    }
+}
+
+/* Language bindings, platform hooks and software debounce need a thread of their own. */
+static mraa_boolean_t
+mraa_gpio_use_dispatcher(mraa_gpio_context dev)
+{
+    if (!mraa_gpio_dispatcher_running() || mraa_is_sub_platform_id(dev->pin)) {
+        return 0;
+    }
+
+    if (IS_FUNC_DEFINED(dev, gpio_interrupt_handler_init_replace) ||
+        IS_FUNC_DEFINED(dev, gpio_wait_interrupt_replace)) {
+        return 0;
+    }
+
+    if (lang_func->python_isr != NULL ||
+        (lang_func->java_isr_callback != NULL && dev->isr == lang_func->java_isr_callback)) {
+        return 0;
+    }
+
+    /* The software debounce timer is polled by the handler thread. */
+    if (dev->debounce != NULL) {
+        return 0;
+    }
+
+    return 1;
+}
+
+static void*
+mraa_gpio_interrupt_handler(void* arg)
+{
+    if (arg == NULL) {
+        syslog(LOG_ERR, "gpio: interrupt_handler: context is invalid");
+        return NULL;
+    }
+
+    mraa_result_t ret;
+    mraa_gpio_context dev = (mraa_gpio_context) arg;
+    int idx = 0;
+
+    if (IS_FUNC_DEFINED(dev, gpio_interrupt_handler_init_replace)) {
+        if (dev->advance_func->gpio_interrupt_handler_init_replace(dev) != MRAA_SUCCESS)
+            return NULL;
+    }
+
+    int* fps = NULL;
+    idx = mraa_gpio_open_event_fds(dev, &fps);
+    if (idx < 0) {
+        return NULL;
+    }
+
+#ifndef HAVE_PTHREAD_CANCEL
+    if (pipe(dev->isr_control_pipe)) {
+        syslog(LOG_ERR, "gpio%i: interrupt_handler: failed to create isr control pipe: %s",
+               dev->pin, strerror(errno));
+        mraa_gpio_close_event_handles_sysfs(fps, dev->num_pins);
+        return NULL;
+    }
+#endif
+
+    if (lang_func->java_attach_thread != NULL) {
+        if (dev->isr == lang_func->java_isr_callback) {
+            if (lang_func->java_attach_thread() != MRAA_SUCCESS) {
+                mraa_gpio_close_event_handles_sysfs(fps, dev->num_pins);
+                return NULL;
+            }
+        }
+    }
+
+    for (;;) {
+        if (IS_FUNC_DEFINED(dev, gpio_wait_interrupt_replace)) {
+            ret = dev->advance_func->gpio_wait_interrupt_replace(dev);
+        } else {
+            if (plat->chardev_capable) {
+                ret = mraa_gpio_chardev_wait_interrupt(dev, fps, idx);
+            } else {
+                ret = mraa_gpio_wait_interrupt(fps, idx
+#ifndef HAVE_PTHREAD_CANCEL
+                                               ,
+                                               dev->isr_control_pipe[0]
+#endif
+                                               ,
+                                               dev);
+            }
+        }
+
+        if (ret == MRAA_SUCCESS && !dev->isr_thread_terminating) {
+#ifdef HAVE_PTHREAD_CANCEL
             pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
 #endif
-            if (lang_func->python_isr != NULL) {
+            if (dev->isr == NULL) {
+                /* Events are only consumed through mraa_gpio_read_events(). */
+            } else if (lang_func->python_isr != NULL) {
                 lang_func->python_isr(dev->isr, dev->isr_args);
             } else {
                 dev->isr(dev->isr_args);
@@ -793,7 +1294,12 @@ mraa_gpio_interrupt_handler(void* arg)
 #ifdef HAVE_PTHREAD_CANCEL
             pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
 #endif
-            mraa_gpio_close_event_handles_sysfs(fps, dev->num_pins);
+            /* Chardev line handles belong to the context, not to this thread. */
+            if (plat->chardev_capable) {
+                free(fps);
+            } else {
+                mraa_gpio_close_event_handles_sysfs(fps, dev->num_pins);
+            }
 
             if (lang_func->java_detach_thread != NULL && lang_func->java_delete_global_ref != NULL) {
                 if (dev->isr == lang_func->java_isr_callback) {
@@ -820,51 +1326,47 @@ mraa_gpio_chardev_edge_mode(mraa_gpio_context dev, mraa_gpio_edge_t mode)
         return MRAA_ERROR_FEATURE_NOT_IMPLEMENTED;
     }
 
-    int status;
+    uint64_t edge_flags;
     mraa_gpiod_group_t gpio_group;
 
-    struct gpioevent_request req;
-
     switch (mode) {
+        case MRAA_GPIO_EDGE_NONE:
+            edge_flags = 0;
+            break;
         case MRAA_GPIO_EDGE_BOTH:
-            req.eventflags = GPIOEVENT_REQUEST_BOTH_EDGES;
+            edge_flags = GPIO_V2_LINE_FLAG_EDGE_RISING | GPIO_V2_LINE_FLAG_EDGE_FALLING;
             break;
         case MRAA_GPIO_EDGE_RISING:
-            req.eventflags = GPIOEVENT_REQUEST_RISING_EDGE;
+            edge_flags = GPIO_V2_LINE_FLAG_EDGE_RISING;
             break;
         case MRAA_GPIO_EDGE_FALLING:
-            req.eventflags = GPIOEVENT_REQUEST_FALLING_EDGE;
+            edge_flags = GPIO_V2_LINE_FLAG_EDGE_FALLING;
             break;
-        /* Chardev interface doesn't handle EDGE_NONE. */
-        case MRAA_GPIO_EDGE_NONE:
         default:
             return MRAA_ERROR_FEATURE_NOT_IMPLEMENTED;
     }
 
     for_each_gpio_group(gpio_group, dev)
     {
-        if (gpio_group->gpiod_handle != -1) {
-            close(gpio_group->gpiod_handle);
-            gpio_group->gpiod_handle = -1;
-        }
+        uint64_t old_edge_flags =
+        gpio_group->flags & (GPIO_V2_LINE_FLAG_EDGE_RISING | GPIO_V2_LINE_FLAG_EDGE_FALLING);
 
-        gpio_group->event_handles = malloc(gpio_group->num_gpio_lines * sizeof(int));
-        if (!gpio_group->event_handles) {
-            syslog(LOG_ERR, "mraa_gpio_chardev_edge_mode(): malloc error!");
-            return MRAA_ERROR_NO_RESOURCES;
+        /* Nothing to do if edge detection was never enabled. */
+        if (edge_flags == 0 && old_edge_flags == 0) {
+            continue;
         }
 
-        for (int i = 0; i < gpio_group->num_gpio_lines; ++i) {
-            req.lineoffset = gpio_group->gpio_lines[i];
-            req.handleflags = GPIOHANDLE_REQUEST_INPUT;
-
-            status = _mraa_gpiod_ioctl(gpio_group->dev_fd, GPIO_GET_LINEEVENT_IOCTL, &req);
-            if (status < 0) {
-                syslog(LOG_ERR, "error getting line event handle for line %i", gpio_group->gpio_lines[i]);
-                return MRAA_ERROR_INVALID_RESOURCE;
-            }
+        gpio_group->flags &= ~old_edge_flags;
+        if (edge_flags) {
+            /* Edge detection is only available on inputs. */
+            gpio_group->flags &= ~(GPIO_V2_LINE_FLAG_OUTPUT | GPIO_V2_LINE_FLAG_OPEN_DRAIN |
+                                   GPIO_V2_LINE_FLAG_OPEN_SOURCE);
+            gpio_group->flags |= GPIO_V2_LINE_FLAG_INPUT | edge_flags;
+        }
 
-            gpio_group->event_handles[i] = req.fd;
+        if (_mraa_gpiod_configure_group(gpio_group) < 0) {
+            syslog(LOG_ERR, "error configuring edge detection for chip %u", gpio_group->gpio_chip);
+            return MRAA_ERROR_INVALID_RESOURCE;
         }
     }
 
@@ -901,6 +1403,10 @@ mraa_gpio_edge_mode(mraa_gpio_context dev, mraa_gpio_edge_t mode)
     mraa_gpio_context it = dev;
 
     while (it) {
+        if (mraa_gpio_shadow_get(it->pin, MRAA_GPIO_SHADOW_EDGE) == (int) mode) {
+            it = it->next;
+            continue;
+        }
 
         if (it->value_fp != -1) {
             close(it->value_fp);
@@ -943,6 +1449,7 @@ mraa_gpio_edge_mode(mraa_gpio_context dev, mraa_gpio_edge_t mode)
         }
 
         close(edge);
+        mraa_gpio_shadow_set(it->pin, MRAA_GPIO_SHADOW_EDGE, mode);
 
         it = it->next;
     }
@@ -950,6 +1457,81 @@ mraa_gpio_edge_mode(mraa_gpio_context dev, mraa_gpio_edge_t mode)
     return MRAA_SUCCESS;
 }
 
+/* Hand the debounce period to the kernel on every chip, 0 removes it again. */
+static mraa_result_t
+mraa_gpio_chardev_debounce(mraa_gpio_context dev, unsigned int stable_us)
+{
+    mraa_gpiod_group_t gpio_iter;
+
+    for_each_gpio_group(gpio_iter, dev)
+    {
+        unsigned int old_period = gpio_iter->debounce_period_us;
+
+        if (old_period == stable_us) {
+            continue;
+        }
+
+        gpio_iter->debounce_period_us = stable_us;
+        if (gpio_iter->gpiod_handle > 0) {
+            if (_mraa_gpiod_configure_group(gpio_iter) == 0) {
+                continue;
+            }
+        } else if (mraa_gpio_chardev_get_handle(gpio_iter, GPIO_V2_LINE_FLAG_INPUT) == MRAA_SUCCESS) {
+            continue;
+        }
+
+        gpio_iter->debounce_period_us = old_period;
+        return MRAA_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+
+    return MRAA_SUCCESS;
+}
+
+mraa_result_t
+mraa_gpio_debounce(mraa_gpio_context dev, unsigned int stable_us, unsigned int vote)
+{
+    if (dev == NULL) {
+        syslog(LOG_ERR, "gpio: debounce: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (dev->thread_id != 0 || dev->dispatch_source != NULL) {
+        syslog(LOG_ERR, "gpio%i: debounce: must be set before mraa_gpio_isr()", dev->pin);
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+
+    if (vote > 1 && vote % 2 == 0) {
+        syslog(LOG_ERR, "gpio%i: debounce: vote count %u must be odd", dev->pin, vote);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    mraa_gpio_debounce_free(dev->debounce);
+    dev->debounce = NULL;
+
+    if (plat->chardev_capable) {
+        /* The kernel filter only knows a stable period, voting needs ours. */
+        mraa_result_t ret = mraa_gpio_chardev_debounce(dev, vote > 1 ? 0 : stable_us);
+        if (ret == MRAA_SUCCESS && vote <= 1) {
+            return MRAA_SUCCESS;
+        }
+        if (ret != MRAA_SUCCESS) {
+            syslog(LOG_NOTICE, "gpio%i: debounce: not supported by the kernel, filtering in software", dev->pin);
+            mraa_gpio_chardev_debounce(dev, 0);
+        }
+    }
+
+    if (stable_us == 0) {
+        return MRAA_SUCCESS;
+    }
+
+    dev->debounce = mraa_gpio_debounce_new(dev->num_pins, stable_us, vote);
+    if (dev->debounce == NULL) {
+        return MRAA_ERROR_NO_RESOURCES;
+    }
+
+    return MRAA_SUCCESS;
+}
+
 mraa_result_t
 mraa_gpio_isr(mraa_gpio_context dev, mraa_gpio_edge_t mode, void (*fptr)(void*), void* args)
 {
@@ -963,10 +1545,18 @@ mraa_gpio_isr(mraa_gpio_context dev, mraa_gpio_edge_t mode, void (*fptr)(void*),
     }
 
     // we only allow one isr per mraa_gpio_context
-    if (dev->thread_id != 0) {
+    if (dev->thread_id != 0 || dev->dispatch_source != NULL) {
         return MRAA_ERROR_NO_RESOURCES;
     }
 
+    // the queue outlives the isr thread so late readers can still drain it
+    if (dev->event_ring == NULL) {
+        dev->event_ring = mraa_gpio_event_ring_new(MRAA_GPIO_EVENT_RING_SIZE);
+        if (dev->event_ring == NULL) {
+            return MRAA_ERROR_NO_RESOURCES;
+        }
+    }
+
     mraa_result_t ret;
 
 
@@ -978,6 +1568,11 @@ mraa_gpio_isr(mraa_gpio_context dev, mraa_gpio_edge_t mode, void (*fptr)(void*),
 
     dev->isr = fptr;
 
+    // a new isr starts from unknown levels, nothing pending
+    if (dev->debounce != NULL) {
+        mraa_gpio_debounce_reset(dev->debounce);
+    }
+
     /* Most UPM sensors use the C API, the Java global ref must be created here. */
     /* The reason for checking the callback function is internal callbacks. */
     if (lang_func->java_create_global_ref != NULL) {
@@ -988,63 +1583,301 @@ mraa_gpio_isr(mraa_gpio_context dev, mraa_gpio_edge_t mode, void (*fptr)(void*),
 
     dev->isr_args = args;
 
+    if (mraa_gpio_use_dispatcher(dev)) {
+        int* fds = NULL;
+        int num_fds = mraa_gpio_open_event_fds(dev, &fds);
+        if (num_fds < 0) {
+            return MRAA_ERROR_INVALID_RESOURCE;
+        }
+
+        // clear any stale sysfs edge before the fds are watched
+        for (int i = 0; !plat->chardev_capable && i < num_fds; ++i) {
+            unsigned char c;
+            pread(fds[i], &c, 1, 0);
+        }
+
+        ret = mraa_gpio_dispatcher_register(dev, fds, num_fds, !plat->chardev_capable);
+        if (ret != MRAA_SUCCESS) {
+            if (plat->chardev_capable) {
+                free(fds);
+            } else {
+                mraa_gpio_close_event_handles_sysfs(fds, num_fds);
+            }
+        }
+
+        return ret;
+    }
+
     pthread_create(&dev->thread_id, NULL, mraa_gpio_interrupt_handler, (void*) dev);
 
     return MRAA_SUCCESS;
 }
 
 mraa_result_t
-mraa_gpio_isr_exit(mraa_gpio_context dev)
+mraa_gpio_isr_exit(mraa_gpio_context dev)
+{
+    mraa_result_t ret = MRAA_SUCCESS;
+
+    if (dev == NULL) {
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (IS_FUNC_DEFINED(dev, gpio_isr_exit_replace)) {
+        return dev->advance_func->gpio_isr_exit_replace(dev);
+    }
+
+    // wasting our time, there is no isr to exit from
+    if (dev->thread_id == 0 && dev->dispatch_source == NULL) {
+        return ret;
+    }
+    // mark the beginning of the thread termination process for interested parties
+    dev->isr_thread_terminating = 1;
+
+    // stop isr being useful
+    ret = mraa_gpio_edge_mode(dev, MRAA_GPIO_EDGE_NONE);
+
+    // the shared dispatcher keeps running, only this context leaves it
+    if (dev->dispatch_source != NULL) {
+        mraa_gpio_dispatcher_unregister(dev);
+    }
+
+    if ((dev->thread_id != 0)) {
+#ifdef HAVE_PTHREAD_CANCEL
+        if ((pthread_cancel(dev->thread_id) != 0) || (pthread_join(dev->thread_id, NULL) != 0)) {
+            ret = MRAA_ERROR_INVALID_RESOURCE;
+        }
+#else
+        close(dev->isr_control_pipe[1]);
+        if (pthread_join(dev->thread_id, NULL) != 0)
+            ret = MRAA_ERROR_INVALID_RESOURCE;
+
+        close(dev->isr_control_pipe[0]);
+        dev->isr_control_pipe[0] = dev->isr_control_pipe[1] = -1;
+#endif
+    }
+
+    // assume our thread will exit either way we just lost it's handle
+    dev->thread_id = 0;
+    dev->isr_value_fp = -1;
+    dev->isr_thread_terminating = 0;
+
+    if (dev->events) {
+        free(dev->events);
+        dev->events = NULL;
+    }
+
+    return ret;
+}
+
+mraa_result_t
+mraa_gpio_counter_start(mraa_gpio_context dev, mraa_gpio_edge_t edge, unsigned int window_ms)
+{
+    mraa_result_t ret;
+
+    if (dev == NULL) {
+        syslog(LOG_ERR, "gpio: counter_start: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    // Replaced isrs never reach the handler that feeds the counter
+    if (IS_FUNC_DEFINED(dev, gpio_isr_replace)) {
+        syslog(LOG_ERR, "gpio%i: counter_start: not supported on this platform", dev->pin);
+        return MRAA_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+
+    if (dev->counter != NULL || dev->thread_id != 0 || dev->dispatch_source != NULL) {
+        syslog(LOG_ERR, "gpio%i: counter_start: an isr is already set on this context", dev->pin);
+        return MRAA_ERROR_NO_RESOURCES;
+    }
+
+    if (edge == MRAA_GPIO_EDGE_NONE) {
+        syslog(LOG_ERR, "gpio%i: counter_start: no edge to count", dev->pin);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    dev->counter = mraa_gpio_counter_new(dev->num_pins > 0 ? dev->num_pins : 1, window_ms);
+    if (dev->counter == NULL) {
+        return MRAA_ERROR_NO_RESOURCES;
+    }
+
+    // edges are only counted, there is no callback to run
+    ret = mraa_gpio_isr(dev, edge, NULL, NULL);
+    if (ret != MRAA_SUCCESS) {
+        mraa_gpio_counter_free(dev->counter);
+        dev->counter = NULL;
+    }
+
+    return ret;
+}
+
+mraa_result_t
+mraa_gpio_counter_read(mraa_gpio_context dev, unsigned int idx, mraa_gpio_counter_value* value)
+{
+    if (dev == NULL) {
+        syslog(LOG_ERR, "gpio: counter_read: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (value == NULL) {
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    if (dev->counter == NULL) {
+        syslog(LOG_ERR, "gpio%i: counter_read: counter not started", dev->pin);
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+
+    return mraa_gpio_counter_get(dev->counter, idx, value);
+}
+
+mraa_result_t
+mraa_gpio_counter_reset(mraa_gpio_context dev)
+{
+    if (dev == NULL) {
+        syslog(LOG_ERR, "gpio: counter_reset: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (dev->counter == NULL) {
+        syslog(LOG_ERR, "gpio%i: counter_reset: counter not started", dev->pin);
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+
+    mraa_gpio_counter_clear(dev->counter);
+
+    return MRAA_SUCCESS;
+}
+
+mraa_result_t
+mraa_gpio_counter_stop(mraa_gpio_context dev)
+{
+    mraa_result_t ret;
+
+    if (dev == NULL) {
+        syslog(LOG_ERR, "gpio: counter_stop: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (dev->counter == NULL) {
+        return MRAA_SUCCESS;
+    }
+
+    // the handler must be gone before the counters it updates
+    ret = mraa_gpio_isr_exit(dev);
+    mraa_gpio_counter_free(dev->counter);
+    dev->counter = NULL;
+
+    return ret;
+}
+
+mraa_result_t
+mraa_gpio_record_start(mraa_gpio_context dev, const char* path, size_t size, mraa_gpio_edge_t edge)
+{
+    mraa_result_t ret;
+    unsigned int num_pins;
+    int pins[64];
+    uint64_t levels;
+
+    if (dev == NULL) {
+        syslog(LOG_ERR, "gpio: record_start: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    // Replaced isrs never reach the handler that appends the records
+    if (IS_FUNC_DEFINED(dev, gpio_isr_replace)) {
+        syslog(LOG_ERR, "gpio%i: record_start: not supported on this platform", dev->pin);
+        return MRAA_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+
+    if (dev->recorder != NULL || dev->counter != NULL || dev->thread_id != 0 || dev->dispatch_source != NULL) {
+        syslog(LOG_ERR, "gpio%i: record_start: an isr is already set on this context", dev->pin);
+        return MRAA_ERROR_NO_RESOURCES;
+    }
+
+    if (path == NULL || edge == MRAA_GPIO_EDGE_NONE) {
+        syslog(LOG_ERR, "gpio%i: record_start: no file or no edge to record", dev->pin);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    if (size < MRAA_GPIO_RECORD_MIN_SIZE) {
+        syslog(LOG_ERR, "gpio%i: record_start: ring of %zu bytes is below the %d minimum", dev->pin,
+               size, MRAA_GPIO_RECORD_MIN_SIZE);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    num_pins = dev->num_pins > 0 ? dev->num_pins : 1;
+    if (num_pins > 64) {
+        syslog(LOG_ERR, "gpio%i: record_start: %u pins do not fit a record", dev->pin, num_pins);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    if (plat->chardev_capable) {
+        for (unsigned int i = 0; i < num_pins; ++i) {
+            pins[i] = dev->provided_pins != NULL ? dev->provided_pins[i] : dev->phy_pin;
+        }
+    } else {
+        mraa_gpio_context it = dev;
+
+        for (unsigned int i = 0; i < num_pins && it != NULL; ++i, it = it->next) {
+            pins[i] = it->phy_pin;
+        }
+    }
+
+    // the levels before the first edge, so the recording can be replayed
+    ret = mraa_gpio_snapshot(dev, &levels, NULL, 0);
+    if (ret != MRAA_SUCCESS) {
+        return ret;
+    }
+
+    dev->recorder = mraa_gpio_recorder_new(path, size, pins, num_pins, levels, mraa_monotonic_ns());
+    if (dev->recorder == NULL) {
+        return MRAA_ERROR_NO_RESOURCES;
+    }
+
+    // edges only go to the file, there is no callback to run
+    ret = mraa_gpio_isr(dev, edge, NULL, NULL);
+    if (ret != MRAA_SUCCESS) {
+        mraa_gpio_recorder_close(dev->recorder, NULL);
+        dev->recorder = NULL;
+    }
+
+    return ret;
+}
+
+mraa_result_t
+mraa_gpio_record_stop(mraa_gpio_context dev, mraa_gpio_record_header* header)
 {
-    mraa_result_t ret = MRAA_SUCCESS;
+    mraa_result_t ret;
 
     if (dev == NULL) {
+        syslog(LOG_ERR, "gpio: record_stop: context is invalid");
         return MRAA_ERROR_INVALID_HANDLE;
     }
 
-    if (IS_FUNC_DEFINED(dev, gpio_isr_exit_replace)) {
-        return dev->advance_func->gpio_isr_exit_replace(dev);
-    }
-
-    // wasting our time, there is no isr to exit from
-    if (dev->thread_id == 0) {
-        return ret;
+    if (dev->recorder == NULL) {
+        syslog(LOG_ERR, "gpio%i: record_stop: not recording", dev->pin);
+        return MRAA_ERROR_INVALID_RESOURCE;
     }
-    // mark the beginning of the thread termination process for interested parties
-    dev->isr_thread_terminating = 1;
-
-    // stop isr being useful
-    if (plat && (plat->chardev_capable))
-        _mraa_close_gpio_event_handles(dev);
-    else
-        ret = mraa_gpio_edge_mode(dev, MRAA_GPIO_EDGE_NONE);
-
-    if ((dev->thread_id != 0)) {
-#ifdef HAVE_PTHREAD_CANCEL
-        if ((pthread_cancel(dev->thread_id) != 0) || (pthread_join(dev->thread_id, NULL) != 0)) {
-            ret = MRAA_ERROR_INVALID_RESOURCE;
-        }
-#else
-        close(dev->isr_control_pipe[1]);
-        if (pthread_join(dev->thread_id, NULL) != 0)
-            ret = MRAA_ERROR_INVALID_RESOURCE;
 
-        close(dev->isr_control_pipe[0]);
-        dev->isr_control_pipe[0] = dev->isr_control_pipe[1] = -1;
-#endif
+    // the handler must be gone before the mapping it writes to
+    ret = mraa_gpio_isr_exit(dev);
+    if (mraa_gpio_recorder_close(dev->recorder, header) != MRAA_SUCCESS) {
+        ret = MRAA_ERROR_UNSPECIFIED;
     }
+    dev->recorder = NULL;
 
-    // assume our thread will exit either way we just lost it's handle
-    dev->thread_id = 0;
-    dev->isr_value_fp = -1;
-    dev->isr_thread_terminating = 0;
+    return ret;
+}
 
-    if (dev->events) {
-        free(dev->events);
-        dev->events = NULL;
+mraa_result_t
+mraa_gpio_record_vcd(const char* path, FILE* out)
+{
+    if (path == NULL || out == NULL) {
+        syslog(LOG_ERR, "gpio: record_vcd: no file or no stream");
+        return MRAA_ERROR_INVALID_PARAMETER;
     }
 
-    return ret;
+    return mraa_gpio_recorder_write_vcd(path, out);
 }
 
 mraa_result_t
@@ -1065,38 +1898,36 @@ mraa_gpio_mode(mraa_gpio_context dev, mraa_gpio_mode_t mode)
     }
 
     if (plat->chardev_capable) {
-        unsigned flags = 0;
-        int line_handle;
+        uint64_t set_flags = 0, clear_flags = 0;
         mraa_gpiod_group_t gpio_iter;
 
-        _mraa_close_gpio_desc(dev);
-
-        /* We save flag values from the first valid line. */
-        for_each_gpio_group(gpio_iter, dev)
-        {
-            mraa_gpiod_line_info* linfo =
-            mraa_get_line_info_by_chip_number(gpio_iter->gpio_chip, gpio_iter->gpio_lines[0]);
-            if (!linfo) {
-                syslog(LOG_ERR, "[GPIOD_INTERFACE]: error getting line info");
-                return MRAA_ERROR_UNSPECIFIED;
-            }
-            flags = linfo->flags;
-            free(linfo);
-
-            /* We don't need to iterate any further. */
-            break;
-        }
-
         /* Without changing the API, for now, we can request only one mode per call. */
         switch (mode) {
+            case MRAA_GPIO_STRONG:
+                clear_flags = GPIO_V2_LINE_FLAG_OPEN_DRAIN | GPIO_V2_LINE_FLAG_OPEN_SOURCE;
+                break;
+            case MRAA_GPIO_PULLUP:
+                clear_flags = GPIO_V2_LINE_FLAG_BIAS_PULL_DOWN | GPIO_V2_LINE_FLAG_BIAS_DISABLED;
+                set_flags = GPIO_V2_LINE_FLAG_BIAS_PULL_UP;
+                break;
+            case MRAA_GPIO_PULLDOWN:
+                clear_flags = GPIO_V2_LINE_FLAG_BIAS_PULL_UP | GPIO_V2_LINE_FLAG_BIAS_DISABLED;
+                set_flags = GPIO_V2_LINE_FLAG_BIAS_PULL_DOWN;
+                break;
+            case MRAA_GPIO_HIZ:
+                clear_flags = GPIO_V2_LINE_FLAG_BIAS_PULL_UP | GPIO_V2_LINE_FLAG_BIAS_PULL_DOWN;
+                set_flags = GPIO_V2_LINE_FLAG_BIAS_DISABLED;
+                break;
             case MRAA_GPIOD_ACTIVE_LOW:
-                flags |= GPIOHANDLE_REQUEST_ACTIVE_LOW;
+                set_flags = GPIO_V2_LINE_FLAG_ACTIVE_LOW;
                 break;
             case MRAA_GPIOD_OPEN_DRAIN:
-                flags |= GPIOHANDLE_REQUEST_OPEN_DRAIN;
+                clear_flags = GPIO_V2_LINE_FLAG_OPEN_SOURCE;
+                set_flags = GPIO_V2_LINE_FLAG_OPEN_DRAIN;
                 break;
             case MRAA_GPIOD_OPEN_SOURCE:
-                flags |= GPIOHANDLE_REQUEST_OPEN_SOURCE;
+                clear_flags = GPIO_V2_LINE_FLAG_OPEN_DRAIN;
+                set_flags = GPIO_V2_LINE_FLAG_OPEN_SOURCE;
                 break;
             default:
                 return MRAA_ERROR_FEATURE_NOT_IMPLEMENTED;
@@ -1104,16 +1935,33 @@ mraa_gpio_mode(mraa_gpio_context dev, mraa_gpio_mode_t mode)
 
         for_each_gpio_group(gpio_iter, dev)
         {
-            line_handle = mraa_get_lines_handle(gpio_iter->dev_fd, gpio_iter->gpio_lines,
-                                                gpio_iter->num_gpio_lines, flags, 0);
-            if (line_handle <= 0) {
-                syslog(LOG_ERR, "[GPIOD_INTERFACE]: error getting line handle");
+            gpio_iter->flags = (gpio_iter->flags & ~clear_flags) | set_flags;
+
+            /* Drive modes only apply to outputs. */
+            if (gpio_iter->flags & (GPIO_V2_LINE_FLAG_OPEN_DRAIN | GPIO_V2_LINE_FLAG_OPEN_SOURCE)) {
+                gpio_iter->flags &= ~(GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_RISING |
+                                      GPIO_V2_LINE_FLAG_EDGE_FALLING);
+                gpio_iter->flags |= GPIO_V2_LINE_FLAG_OUTPUT;
+            }
+
+            /* Lines not requested yet pick the new flags up on first use. */
+            if (gpio_iter->gpiod_handle <= 0) {
+                continue;
+            }
+
+            /* Keep outputs at their current level across the reconfiguration. */
+            if ((gpio_iter->flags & GPIO_V2_LINE_FLAG_OUTPUT) &&
+                mraa_get_line_bits(gpio_iter->gpiod_handle, MRAA_GPIOD_LINES_MASK(gpio_iter->num_gpio_lines),
+                                   &gpio_iter->output_values) < 0) {
                 return MRAA_ERROR_INVALID_RESOURCE;
             }
 
-            gpio_iter->gpiod_handle = line_handle;
+            if (_mraa_gpiod_configure_group(gpio_iter) < 0) {
+                syslog(LOG_ERR, "[GPIOD_INTERFACE]: error configuring line mode");
+                return MRAA_ERROR_INVALID_RESOURCE;
+            }
         }
-    } else {
+    } else if (mraa_gpio_shadow_get(dev->pin, MRAA_GPIO_SHADOW_MODE) != (int) mode) {
 
         if (dev->value_fp != -1) {
             close(dev->value_fp);
@@ -1155,6 +2003,7 @@ mraa_gpio_mode(mraa_gpio_context dev, mraa_gpio_mode_t mode)
         }
 
         close(drive);
+        mraa_gpio_shadow_set(dev->pin, MRAA_GPIO_SHADOW_MODE, mode);
     }
 
     if (IS_FUNC_DEFINED(dev, gpio_mode_post))
@@ -1166,53 +2015,41 @@ mraa_gpio_mode(mraa_gpio_context dev, mraa_gpio_mode_t mode)
 mraa_result_t
 mraa_gpio_chardev_dir(mraa_gpio_context dev, mraa_gpio_dir_t dir)
 {
-    int line_handle;
-    unsigned flags = 0;
+    uint64_t flags;
     mraa_gpiod_group_t gpio_iter;
 
     for_each_gpio_group(gpio_iter, dev)
     {
-        mraa_gpiod_line_info* linfo =
-        mraa_get_line_info_by_chip_number(gpio_iter->gpio_chip, gpio_iter->gpio_lines[0]);
-        if (!linfo) {
-            syslog(LOG_ERR, "[GPIOD_INTERFACE]: error getting line info");
-            return MRAA_ERROR_UNSPECIFIED;
+        flags = gpio_iter->flags & ~(GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_OUTPUT);
+
+        switch (dir) {
+            case MRAA_GPIO_OUT:
+            case MRAA_GPIO_OUT_HIGH:
+            case MRAA_GPIO_OUT_LOW:
+                flags &= ~(GPIO_V2_LINE_FLAG_EDGE_RISING | GPIO_V2_LINE_FLAG_EDGE_FALLING);
+                flags |= GPIO_V2_LINE_FLAG_OUTPUT;
+                break;
+            case MRAA_GPIO_IN:
+                flags &= ~(GPIO_V2_LINE_FLAG_OPEN_DRAIN | GPIO_V2_LINE_FLAG_OPEN_SOURCE);
+                flags |= GPIO_V2_LINE_FLAG_INPUT;
+                break;
+            default:
+                return MRAA_ERROR_FEATURE_NOT_IMPLEMENTED;
         }
-        flags = linfo->flags;
-        free(linfo);
-
-        /* We don't need to iterate any further. */
-        break;
-    }
 
-    switch (dir) {
-        case MRAA_GPIO_OUT:
-            flags |= GPIOHANDLE_REQUEST_OUTPUT;
-            flags &= ~GPIOHANDLE_REQUEST_INPUT;
-            break;
-        case MRAA_GPIO_IN:
-            flags |= GPIOHANDLE_REQUEST_INPUT;
-            flags &= ~GPIOHANDLE_REQUEST_OUTPUT;
-            break;
-        default:
-            return MRAA_ERROR_FEATURE_NOT_IMPLEMENTED;
-    }
-
-    for_each_gpio_group(gpio_iter, dev)
-    {
-        if (gpio_iter->gpiod_handle != -1) {
-            close(gpio_iter->gpiod_handle);
-            gpio_iter->gpiod_handle = -1;
+        /* Already requested with this configuration, skip the ioctl. */
+        if (gpio_iter->gpiod_handle > 0 && flags == gpio_iter->flags &&
+            dir != MRAA_GPIO_OUT_HIGH && dir != MRAA_GPIO_OUT_LOW) {
+            continue;
         }
 
-        line_handle = mraa_get_lines_handle(gpio_iter->dev_fd, gpio_iter->gpio_lines,
-                                            gpio_iter->num_gpio_lines, flags, 0);
-        if (line_handle <= 0) {
+        gpio_iter->flags = flags;
+        gpio_iter->output_values = dir == MRAA_GPIO_OUT_HIGH ? ~0ULL : 0;
+
+        if (_mraa_gpiod_configure_group(gpio_iter) < 0) {
             syslog(LOG_ERR, "[GPIOD_INTERFACE]: error getting line handle");
             return MRAA_ERROR_INVALID_RESOURCE;
         }
-
-        gpio_iter->gpiod_handle = line_handle;
     }
 
     return MRAA_SUCCESS;
@@ -1262,12 +2099,27 @@ mraa_gpio_dir(mraa_gpio_context dev, mraa_gpio_dir_t dir)
         }
     }
 
+    if (dev->mmap_port != NULL && dev->mmap_port->banks[0].dir != NULL) {
+        // the register write bypasses sysfs, whatever it last held is stale
+        for (mraa_gpio_context it = dev; !plat->chardev_capable && it != NULL; it = it->next) {
+            mraa_gpio_shadow_invalidate(it->pin);
+        }
+        return mraa_gpio_mmap_dir(dev, dir);
+    }
+
     if (plat->chardev_capable)
         return mraa_gpio_chardev_dir(dev, dir);
 
     mraa_gpio_context it = dev;
 
     while (it) {
+        /* OUT_HIGH and OUT_LOW also set the level, they always go to sysfs. */
+        if ((dir == MRAA_GPIO_IN || dir == MRAA_GPIO_OUT) &&
+            mraa_gpio_shadow_get(it->pin, MRAA_GPIO_SHADOW_DIR) == (int) dir) {
+            it = it->next;
+            continue;
+        }
+
         if (it->value_fp != -1) {
             close(it->value_fp);
             it->value_fp = -1;
@@ -1327,6 +2179,7 @@ mraa_gpio_dir(mraa_gpio_context dev, mraa_gpio_dir_t dir)
         }
 
         close(direction);
+        mraa_gpio_shadow_set(it->pin, MRAA_GPIO_SHADOW_DIR, dir == MRAA_GPIO_IN ? MRAA_GPIO_IN : MRAA_GPIO_OUT);
         it = it->next;
     }
 
@@ -1342,7 +2195,7 @@ mraa_gpio_read_dir(mraa_gpio_context dev, mraa_gpio_dir_t* dir)
     mraa_result_t result = MRAA_SUCCESS;
 
     /* Initialize with 'unusable'. */
-    unsigned flags = GPIOLINE_FLAG_KERNEL;
+    uint64_t flags = GPIO_V2_LINE_FLAG_USED;
 
     if (IS_FUNC_DEFINED(dev, gpio_read_dir_replace)) {
         return dev->advance_func->gpio_read_dir_replace(dev, dir);
@@ -1353,6 +2206,12 @@ mraa_gpio_read_dir(mraa_gpio_context dev, mraa_gpio_dir_t* dir)
 
         for_each_gpio_group(gpio_iter, dev)
         {
+            /* Lines we hold report our own configuration. */
+            if (gpio_iter->gpiod_handle > 0) {
+                flags = gpio_iter->flags;
+                break;
+            }
+
             mraa_gpiod_line_info* linfo =
             mraa_get_line_info_by_chip_number(gpio_iter->gpio_chip, gpio_iter->gpio_lines[0]);
             if (!linfo) {
@@ -1366,12 +2225,12 @@ mraa_gpio_read_dir(mraa_gpio_context dev, mraa_gpio_dir_t* dir)
             break;
         }
 
-        if (flags & GPIOLINE_FLAG_KERNEL) {
-            syslog(LOG_ERR, "[GPIOD_INTERFACE]: cannot read gpio direction. Line used by kernel.");
+        if (flags & GPIO_V2_LINE_FLAG_USED) {
+            syslog(LOG_ERR, "[GPIOD_INTERFACE]: cannot read gpio direction. Line used by another consumer.");
             return MRAA_ERROR_UNSPECIFIED;
         }
 
-        *dir = flags & GPIOLINE_FLAG_IS_OUT ? MRAA_GPIO_OUT : MRAA_GPIO_IN;
+        *dir = flags & GPIO_V2_LINE_FLAG_OUTPUT ? MRAA_GPIO_OUT : MRAA_GPIO_IN;
     } else {
         char filepath[MAX_SIZE];
         int fd;
@@ -1396,6 +2255,10 @@ mraa_gpio_read_dir(mraa_gpio_context dev, mraa_gpio_dir_t* dir)
 
         result = gpio_sysfs_read_dir(dev, fd, dir);
         close(fd);
+
+        if (result == MRAA_SUCCESS) {
+            mraa_gpio_shadow_set(dev->pin, MRAA_GPIO_SHADOW_DIR, *dir);
+        }
     }
 
     return result;
@@ -1413,6 +2276,25 @@ mraa_gpio_read(mraa_gpio_context dev)
         return dev->advance_func->gpio_read_replace(dev);
     }
 
+    if (dev->mmap_read != NULL) {
+        return dev->mmap_read(dev);
+    }
+
+    if (dev->line_group != NULL) {
+        uint64_t bits = 0;
+
+        if (mraa_gpio_chardev_get_handle(dev->line_group, GPIO_V2_LINE_FLAG_INPUT) != MRAA_SUCCESS) {
+            return -1;
+        }
+
+        if (mraa_get_line_bits(dev->line_group->gpiod_handle, 1ULL, &bits) < 0) {
+            syslog(LOG_ERR, "[GPIOD_INTERFACE]: error reading gpio");
+            return -1;
+        }
+
+        return (int) (bits & 1ULL);
+    }
+
     if (plat->chardev_capable) {
         int output_values[1] = { 0 };
 
@@ -1422,27 +2304,30 @@ mraa_gpio_read(mraa_gpio_context dev)
         return output_values[0];
     }
 
-    if (dev->mmap_read != NULL) {
-        return dev->mmap_read(dev);
-    }
-
     if (dev->value_fp == -1) {
         if (_mraa_gpio_get_valfp(dev) != MRAA_SUCCESS) {
             return -1;
         }
-    } else {
-        // if value_fp is new this is pointless
-        lseek(dev->value_fp, 0, SEEK_SET);
     }
+
+    // sysfs regenerates the attribute on every read at offset 0, so the file
+    // position never has to be rewound
     char bu[2];
-    if (read(dev->value_fp, bu, 2 * sizeof(char)) != 2) {
+    if (pread(dev->value_fp, bu, 2 * sizeof(char), 0) != 2) {
         syslog(LOG_ERR, "gpio%i: read: Failed to read a sensible value from sysfs: %s", dev->pin,
                strerror(errno));
         return -1;
     }
-    lseek(dev->value_fp, 0, SEEK_SET);
 
-    return (int) strtol(bu, NULL, 10);
+    switch (bu[0]) {
+        case '0':
+            return 0;
+        case '1':
+            return 1;
+        default:
+            syslog(LOG_ERR, "gpio%i: read: Unexpected value '%c' in sysfs", dev->pin, bu[0]);
+            return -1;
+    }
 }
 
 mraa_result_t
@@ -1453,6 +2338,10 @@ mraa_gpio_read_multi(mraa_gpio_context dev, int output_values[])
         return -1;
     }
 
+    if (dev->mmap_port != NULL) {
+        return mraa_gpio_mmap_read_multi(dev, output_values);
+    }
+
     if (plat->chardev_capable) {
         memset(output_values, 0, dev->num_pins * sizeof(int));
 
@@ -1461,15 +2350,9 @@ mraa_gpio_read_multi(mraa_gpio_context dev, int output_values[])
         for_each_gpio_group(gpio_iter, dev)
         {
             int status;
-            unsigned flags = GPIOHANDLE_REQUEST_INPUT;
 
-            if (gpio_iter->gpiod_handle <= 0) {
-                gpio_iter->gpiod_handle = mraa_get_lines_handle(gpio_iter->dev_fd, gpio_iter->gpio_lines,
-                                                                gpio_iter->num_gpio_lines, flags, 0);
-                if (gpio_iter->gpiod_handle <= 0) {
-                    syslog(LOG_ERR, "[GPIOD_INTERFACE]: error getting gpio line handle");
-                    return MRAA_ERROR_INVALID_HANDLE;
-                }
+            if (mraa_gpio_chardev_get_handle(gpio_iter, GPIO_V2_LINE_FLAG_INPUT) != MRAA_SUCCESS) {
+                return MRAA_ERROR_INVALID_HANDLE;
             }
 
             status =
@@ -1505,6 +2388,77 @@ mraa_gpio_read_multi(mraa_gpio_context dev, int output_values[])
     return MRAA_SUCCESS;
 }
 
+mraa_result_t
+mraa_gpio_snapshot(mraa_gpio_context dev, uint64_t* values, mraa_timestamp_t timestamps[], mraa_boolean_t parallel)
+{
+    if (dev == NULL) {
+        syslog(LOG_ERR, "gpio: snapshot: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (values == NULL) {
+        syslog(LOG_ERR, "gpio%i: snapshot: output parameter for values is invalid", dev->pin);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    if (dev->num_pins > 64) {
+        syslog(LOG_ERR, "gpio%i: snapshot: %u pins do not fit a 64 bit mask", dev->pin, dev->num_pins);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    *values = 0;
+
+    if (dev->mmap_port != NULL) {
+        int levels[dev->num_pins > 0 ? dev->num_pins : 1];
+        mraa_timestamp_t now = mraa_monotonic_ns();
+
+        if (mraa_gpio_mmap_read_multi(dev, levels) != MRAA_SUCCESS) {
+            return MRAA_ERROR_INVALID_RESOURCE;
+        }
+
+        for (unsigned int i = 0; i < (dev->num_pins > 0 ? dev->num_pins : 1); ++i) {
+            *values |= (uint64_t) (levels[i] ? 1 : 0) << i;
+            if (timestamps != NULL) {
+                timestamps[i] = now;
+            }
+        }
+
+        return MRAA_SUCCESS;
+    }
+
+    if (plat->chardev_capable) {
+        mraa_gpiod_group_t gpio_iter;
+
+        for_each_gpio_group(gpio_iter, dev)
+        {
+            if (mraa_gpio_chardev_get_handle(gpio_iter, GPIO_V2_LINE_FLAG_INPUT) != MRAA_SUCCESS) {
+                return MRAA_ERROR_INVALID_HANDLE;
+            }
+        }
+
+        return mraa_gpio_snapshot_chardev(dev, values, timestamps, parallel);
+    }
+
+    /* sysfs has one value file per pin, each read gets its own timestamp */
+    mraa_gpio_context it = dev;
+
+    for (int i = 0; it != NULL; ++i, it = it->next) {
+        int level = mraa_gpio_read(it);
+
+        if (level == -1) {
+            syslog(LOG_ERR, "gpio%i: snapshot: failed to read pin %d", dev->pin, i);
+            return MRAA_ERROR_INVALID_RESOURCE;
+        }
+
+        *values |= (uint64_t) (level ? 1 : 0) << i;
+        if (timestamps != NULL) {
+            timestamps[i] = mraa_monotonic_ns();
+        }
+    }
+
+    return MRAA_SUCCESS;
+}
+
 mraa_result_t
 mraa_gpio_write(mraa_gpio_context dev, int value)
 {
@@ -1523,30 +2477,36 @@ mraa_gpio_write(mraa_gpio_context dev, int value)
         return dev->advance_func->gpio_write_replace(dev, value);
     }
 
+    if (dev->mmap_write != NULL) {
+        return dev->mmap_write(dev, value);
+    }
+
+    if (dev->line_group != NULL) {
+        if (mraa_gpio_chardev_get_handle(dev->line_group, GPIO_V2_LINE_FLAG_OUTPUT) != MRAA_SUCCESS) {
+            return MRAA_ERROR_INVALID_HANDLE;
+        }
+
+        if (mraa_set_line_bits(dev->line_group->gpiod_handle, 1ULL, value ? 1ULL : 0ULL) < 0) {
+            syslog(LOG_ERR, "[GPIOD_INTERFACE]: error writing gpio");
+            return MRAA_ERROR_INVALID_RESOURCE;
+        }
+
+        return MRAA_SUCCESS;
+    }
+
     if (plat->chardev_capable) {
         int input_values[1] = { value };
 
         return mraa_gpio_write_multi(dev, input_values);
     }
 
-    if (dev->mmap_write != NULL) {
-        return dev->mmap_write(dev, value);
-    }
-
     if (dev->value_fp == -1) {
         if (_mraa_gpio_get_valfp(dev) != MRAA_SUCCESS) {
             return MRAA_ERROR_INVALID_RESOURCE;
         }
     }
 
-    if (lseek(dev->value_fp, 0, SEEK_SET) == -1) {
-        syslog(LOG_ERR, "gpio%i: write: Failed to lseek 'value': %s", dev->pin, strerror(errno));
-        return MRAA_ERROR_UNSPECIFIED;
-    }
-
-    char bu[MAX_SIZE];
-    int length = snprintf(bu, sizeof(bu), "%d", value);
-    if (write(dev->value_fp, bu, length * sizeof(char)) == -1) {
+    if (pwrite(dev->value_fp, value ? "1" : "0", sizeof(char), 0) == -1) {
         syslog(LOG_ERR, "gpio%i: write: Failed to write to 'value': %s", dev->pin, strerror(errno));
         return MRAA_ERROR_UNSPECIFIED;
     }
@@ -1566,35 +2526,24 @@ mraa_gpio_write_multi(mraa_gpio_context dev, int input_values[])
         return MRAA_ERROR_INVALID_HANDLE;
     }
 
+    if (dev->mmap_port != NULL) {
+        return mraa_gpio_mmap_write_multi(dev, input_values);
+    }
+
     if (plat->chardev_capable) {
         mraa_gpiod_group_t gpio_iter;
 
-        int* counters = calloc(dev->num_chips, sizeof(int));
-        if (counters == NULL) {
-            syslog(LOG_ERR, "mraa_gpio_write_multi() malloc error");
-            return MRAA_ERROR_NO_RESOURCES;
-        }
-
         for (int i = 0; i < dev->num_pins; ++i) {
-            int chip_id = dev->pin_to_gpio_table[i];
-            gpio_iter = &dev->gpio_group[chip_id];
-            gpio_iter->rw_values[counters[chip_id]] = input_values[i];
-            counters[chip_id]++;
+            gpio_iter = &dev->gpio_group[dev->pin_to_gpio_table[i]];
+            gpio_iter->rw_values[dev->pin_to_slot_table[i]] = input_values[i];
         }
-        free(counters);
 
         for_each_gpio_group(gpio_iter, dev)
         {
             int status;
-            unsigned flags = GPIOHANDLE_REQUEST_OUTPUT;
 
-            if (gpio_iter->gpiod_handle <= 0) {
-                gpio_iter->gpiod_handle = mraa_get_lines_handle(gpio_iter->dev_fd, gpio_iter->gpio_lines,
-                                                                gpio_iter->num_gpio_lines, flags, 0);
-                if (gpio_iter->gpiod_handle <= 0) {
-                    syslog(LOG_ERR, "[GPIOD_INTERFACE]: error getting gpio line handle");
-                    return MRAA_ERROR_INVALID_HANDLE;
-                }
+            if (mraa_gpio_chardev_get_handle(gpio_iter, GPIO_V2_LINE_FLAG_OUTPUT) != MRAA_SUCCESS) {
+                return MRAA_ERROR_INVALID_HANDLE;
             }
 
             status =
@@ -1622,41 +2571,65 @@ mraa_gpio_write_multi(mraa_gpio_context dev, int input_values[])
     return MRAA_SUCCESS;
 }
 
-static mraa_result_t
-mraa_gpio_unexport_force(mraa_gpio_context dev)
+mraa_result_t
+mraa_gpio_write_mask(mraa_gpio_context dev, uint64_t values, uint64_t mask)
 {
-    int unexport = open(SYSFS_CLASS_GPIO "/unexport", O_WRONLY);
-    if (unexport == -1) {
-        syslog(LOG_ERR, "gpio%i: Failed to open 'unexport' for writing: %s", dev->pin, strerror(errno));
-        return MRAA_ERROR_INVALID_RESOURCE;
+    if (dev == NULL) {
+        syslog(LOG_ERR, "gpio: write_mask: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
     }
 
-    char bu[MAX_SIZE];
-    int length = snprintf(bu, sizeof(bu), "%d", dev->pin);
-    if (write(unexport, bu, length * sizeof(char)) == -1) {
-        syslog(LOG_ERR, "gpio%i: Failed to write to 'unexport': %s", dev->pin, strerror(errno));
-        close(unexport);
-        return MRAA_ERROR_UNSPECIFIED;
+    if (dev->mmap_port != NULL) {
+        return mraa_gpio_mmap_write_mask(dev, values, mask);
     }
 
-    close(unexport);
-    mraa_gpio_isr_exit(dev);
-    return MRAA_SUCCESS;
-}
+    if (plat->chardev_capable) {
+        mraa_gpiod_group_t gpio_iter;
 
-static mraa_result_t
-mraa_gpio_unexport(mraa_gpio_context dev)
-{
-    if (dev == NULL) {
-        syslog(LOG_ERR, "gpio: unexport: context is invalid");
-        return MRAA_ERROR_INVALID_HANDLE;
-    }
+        for_each_gpio_group(gpio_iter, dev)
+        {
+            uint64_t line_bits = 0, line_mask = 0;
+
+            for (int j = 0; j < gpio_iter->num_gpio_lines; ++j) {
+                unsigned int pin_idx = gpio_iter->gpio_group_to_pins_table[j];
+                if (pin_idx < 64 && (mask & (1ULL << pin_idx))) {
+                    line_mask |= 1ULL << j;
+                    line_bits |= ((values >> pin_idx) & 1ULL) << j;
+                }
+            }
+
+            /* Leave chips without masked pins alone. */
+            if (line_mask == 0) {
+                continue;
+            }
+
+            if (mraa_gpio_chardev_get_handle(gpio_iter, GPIO_V2_LINE_FLAG_OUTPUT) != MRAA_SUCCESS) {
+                return MRAA_ERROR_INVALID_HANDLE;
+            }
+
+            if (mraa_set_line_bits(gpio_iter->gpiod_handle, line_mask, line_bits) < 0) {
+                syslog(LOG_ERR, "[GPIOD_INTERFACE]: error writing gpio");
+                return MRAA_ERROR_INVALID_RESOURCE;
+            }
+        }
+    } else {
+        mraa_gpio_context it = dev;
+        mraa_result_t status;
+
+        for (int i = 0; it != NULL && i < 64; ++i, it = it->next) {
+            if (!(mask & (1ULL << i))) {
+                continue;
+            }
 
-    if (dev->owner) {
-        return mraa_gpio_unexport_force(dev);
+            status = mraa_gpio_write(it, (values >> i) & 1);
+            if (status != MRAA_SUCCESS) {
+                syslog(LOG_ERR, "gpio: write_mask: failed to write to multiple gpio pins");
+                return status;
+            }
+        }
     }
 
-    return MRAA_ERROR_INVALID_PARAMETER;
+    return MRAA_SUCCESS;
 }
 
 mraa_result_t
@@ -1682,7 +2655,8 @@ _mraa_gpio_close_internal(mraa_gpio_context dev)
         close(dev->value_fp);
     }
 
-    mraa_gpio_unexport(dev);
+    // the pin is unexported once its last context is gone
+    mraa_gpio_registry_release(dev->pin_ref, dev->owner);
 
     free(dev);
 
@@ -1699,12 +2673,32 @@ mraa_gpio_close(mraa_gpio_context dev)
         return MRAA_ERROR_INVALID_HANDLE;
     }
 
+    /* Free any ISRs */
+    mraa_gpio_isr_exit(dev);
+
     if (dev->events) {
         free(dev->events);
+        dev->events = NULL;
     }
 
-    /* Free any ISRs */
-    mraa_gpio_isr_exit(dev);
+    // Readers still blocked in mraa_gpio_capture_read() return -1
+    mraa_gpio_event_ring_close(&dev->event_ring);
+
+    mraa_gpio_debounce_free(dev->debounce);
+    dev->debounce = NULL;
+
+    mraa_gpio_counter_free(dev->counter);
+    dev->counter = NULL;
+
+    mraa_gpio_snapshot_pool_free(dev->snapshot_pool);
+    dev->snapshot_pool = NULL;
+
+    mraa_gpio_recorder_close(dev->recorder, NULL);
+    dev->recorder = NULL;
+
+    if (dev->mmap_port != NULL) {
+        mraa_gpio_mmap_setup(dev, NULL, 0);
+    }
 
     if (plat && plat->chardev_capable) {
         _mraa_free_gpio_groups(dev);
@@ -1751,6 +2745,10 @@ mraa_gpio_use_mmaped(mraa_gpio_context dev, mraa_boolean_t mmap_en)
         return dev->advance_func->gpio_mmap_setup(dev, mmap_en);
     }
 
+    if (plat != NULL && plat->gpio_mmap != NULL) {
+        return mraa_gpio_mmap_setup(dev, plat->gpio_mmap, mmap_en);
+    }
+
     syslog(LOG_ERR, "gpio%i: use_mmaped: mmap not implemented on this platform", dev->pin);
 
     return MRAA_ERROR_FEATURE_NOT_IMPLEMENTED;
@@ -6,6 +6,7 @@
  */
 
 #include "gpio/gpio_chardev.h"
+#include "gpio/gpio_registry.h"
 #include "linux/gpio.h"
 #include "mraa_internal.h"
 
@@ -53,15 +54,7 @@ _mraa_free_gpio_groups(mraa_gpio_context dev)
             close(gpio_iter->gpiod_handle);
         }
 
-        if (gpio_iter->event_handles != NULL) {
-            for (int j = 0; j < gpio_iter->num_gpio_lines; ++j) {
-                close(gpio_iter->event_handles[j]);
-            }
-
-            free(gpio_iter->event_handles);
-        }
-
-        close(gpio_iter->dev_fd);
+        mraa_gpio_registry_chip_release(gpio_iter->gpio_chip);
     }
 
     if (dev->gpio_group) {
@@ -73,6 +66,10 @@ _mraa_free_gpio_groups(mraa_gpio_context dev)
         free(dev->pin_to_gpio_table);
     }
 
+    if (dev->pin_to_slot_table) {
+        free(dev->pin_to_slot_table);
+    }
+
     /* User provided array saved internally. */
     if (dev->provided_pins) {
         free(dev->provided_pins);
@@ -84,78 +81,109 @@ _mraa_free_gpio_groups(mraa_gpio_context dev)
     }
 }
 
+int
+_mraa_gpiod_ioctl(int fd, unsigned long gpio_request, void* data)
+{
+    int status;
+
+    status = ioctl(fd, gpio_request, data);
+    if (status < 0) {
+        syslog(LOG_ERR, "[GPIOD_INTERFACE]: ioctl() error %s", strerror(errno));
+    }
+
+    return status;
+}
+
 void
-_mraa_close_gpio_event_handles(mraa_gpio_context dev)
+mraa_get_lines_config(mraa_gpiod_group_t group, struct gpio_v2_line_config* config)
 {
-    mraa_gpiod_group_t gpio_iter;
+    uint64_t all_lines = MRAA_GPIOD_LINES_MASK(group->num_gpio_lines);
 
-    for_each_gpio_group(gpio_iter, dev)
-    {
-        if (gpio_iter->event_handles != NULL) {
-            for (int j = 0; j < gpio_iter->num_gpio_lines; ++j) {
-                close(gpio_iter->event_handles[j]);
-            }
+    memset(config, 0, sizeof *config);
 
-            free(gpio_iter->event_handles);
+    config->flags = group->flags;
 
-            /* In the end, _mraa_free_gpio_groups will be called. */
-            gpio_iter->event_handles = NULL;
-        }
+    if (group->flags & GPIO_V2_LINE_FLAG_OUTPUT) {
+        config->attrs[config->num_attrs].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+        config->attrs[config->num_attrs].attr.values = group->output_values;
+        config->attrs[config->num_attrs].mask = all_lines;
+        config->num_attrs++;
+    }
+
+    if (group->debounce_period_us) {
+        config->attrs[config->num_attrs].attr.id = GPIO_V2_LINE_ATTR_ID_DEBOUNCE;
+        config->attrs[config->num_attrs].attr.debounce_period_us = group->debounce_period_us;
+        config->attrs[config->num_attrs].mask = all_lines;
+        config->num_attrs++;
     }
 }
 
-void
-_mraa_close_gpio_desc(mraa_gpio_context dev)
+int
+mraa_get_lines_handle(int chip_fd, unsigned line_offsets[], unsigned num_lines, struct gpio_v2_line_config* config)
 {
-    mraa_gpiod_group_t gpio_iter;
+    int status;
+    struct gpio_v2_line_request __gpio_req;
 
-    for_each_gpio_group(gpio_iter, dev)
-    {
-        if (gpio_iter->gpiod_handle != -1) {
-            close(gpio_iter->gpiod_handle);
-            gpio_iter->gpiod_handle = -1;
-        }
+    if (num_lines > GPIO_V2_LINES_MAX) {
+        syslog(LOG_ERR, "[GPIOD_INTERFACE]: too many lines requested on one chip");
+        return -1;
+    }
+
+    memset(&__gpio_req, 0, sizeof __gpio_req);
+    memcpy(__gpio_req.offsets, line_offsets, num_lines * sizeof __gpio_req.offsets[0]);
+    memcpy(&__gpio_req.config, config, sizeof __gpio_req.config);
+    strncpy(__gpio_req.consumer, "mraa", sizeof __gpio_req.consumer - 1);
+    __gpio_req.num_lines = num_lines;
+
+    status = _mraa_gpiod_ioctl(chip_fd, GPIO_V2_GET_LINE_IOCTL, &__gpio_req);
+    if (status < 0) {
+        syslog(LOG_ERR, "gpiod: ioctl() fail");
+        return status;
+    }
+
+    if (__gpio_req.fd <= 0) {
+        syslog(LOG_ERR, "[GPIOD_INTERFACE]: invalid file descriptor");
     }
+
+    return __gpio_req.fd;
 }
 
 int
-_mraa_gpiod_ioctl(int fd, unsigned long gpio_request, void* data)
+mraa_set_lines_config(int line_handle, struct gpio_v2_line_config* config)
 {
     int status;
 
-    status = ioctl(fd, gpio_request, data);
+    status = _mraa_gpiod_ioctl(line_handle, GPIO_V2_LINE_SET_CONFIG_IOCTL, config);
     if (status < 0) {
-        syslog(LOG_ERR, "[GPIOD_INTERFACE]: ioctl() error %s", strerror(errno));
+        syslog(LOG_ERR, "[GPIOD_INTERFACE]: ioctl() fail");
     }
 
     return status;
 }
 
 int
-mraa_get_lines_handle(int chip_fd, unsigned line_offsets[], unsigned num_lines, unsigned flags, unsigned default_value)
+_mraa_gpiod_configure_group(mraa_gpiod_group_t group)
 {
-    int status;
-    struct gpiohandle_request __gpio_hreq;
+    struct gpio_v2_line_config config;
 
-    __gpio_hreq.lines = num_lines;
-    memcpy(__gpio_hreq.lineoffsets, line_offsets, num_lines * sizeof __gpio_hreq.lineoffsets[0]);
+    mraa_get_lines_config(group, &config);
 
-    if (flags & GPIOHANDLE_REQUEST_OUTPUT) {
-        memset(__gpio_hreq.default_values, 0, num_lines * sizeof __gpio_hreq.default_values[0]);
+    /* Lines already requested only need their configuration updated. */
+    if (group->gpiod_handle > 0) {
+        return mraa_set_lines_config(group->gpiod_handle, &config);
     }
-    __gpio_hreq.flags = flags;
 
-    status = _mraa_gpiod_ioctl(chip_fd, GPIO_GET_LINEHANDLE_IOCTL, &__gpio_hreq);
-    if (status < 0) {
-        syslog(LOG_ERR, "gpiod: ioctl() fail");
-        return status;
+    group->gpiod_handle =
+    mraa_get_lines_handle(group->dev_fd, group->gpio_lines, group->num_gpio_lines, &config);
+    if (group->gpiod_handle <= 0) {
+        group->gpiod_handle = -1;
+        return -1;
     }
 
-    if (__gpio_hreq.fd <= 0) {
-        syslog(LOG_ERR, "[GPIOD_INTERFACE]: invalid file descriptor");
-    }
+    /* Event sequence numbers restart with every new request. */
+    group->last_seqno = 0;
 
-    return __gpio_hreq.fd;
+    return 0;
 }
 
 mraa_gpiod_chip_info*
@@ -250,15 +278,15 @@ mraa_get_line_info_from_descriptor(int chip_fd, unsigned line_number)
     int status;
     mraa_gpiod_line_info* linfo;
 
-    linfo = malloc(sizeof *linfo);
+    linfo = calloc(1, sizeof *linfo);
 
     if (!linfo) {
         syslog(LOG_ERR, "[GPIOD_INTERFACE]: malloc() fail");
         return NULL;
     }
 
-    linfo->line_offset = line_number;
-    status = _mraa_gpiod_ioctl(chip_fd, GPIO_GET_LINEINFO_IOCTL, linfo);
+    linfo->offset = line_number;
+    status = _mraa_gpiod_ioctl(chip_fd, GPIO_V2_GET_LINEINFO_IOCTL, linfo);
     if (status < 0) {
         free(linfo);
         return NULL;
@@ -328,14 +356,15 @@ mraa_get_line_info_by_chip_label(const char* chip_label, unsigned line_number)
 }
 
 int
-mraa_set_line_values(int line_handle, unsigned int num_lines, unsigned char input_values[])
+mraa_set_line_bits(int line_handle, uint64_t mask, uint64_t bits)
 {
     int status;
-    struct gpiohandle_data __hdata;
+    struct gpio_v2_line_values __vdata;
 
-    memcpy(__hdata.values, input_values, num_lines * sizeof(unsigned char));
+    __vdata.bits = bits;
+    __vdata.mask = mask;
 
-    status = _mraa_gpiod_ioctl(line_handle, GPIOHANDLE_SET_LINE_VALUES_IOCTL, &__hdata);
+    status = _mraa_gpiod_ioctl(line_handle, GPIO_V2_LINE_SET_VALUES_IOCTL, &__vdata);
     if (status < 0) {
         syslog(LOG_ERR, "[GPIOD_INTERFACE]: ioctl() fail");
     }
@@ -344,18 +373,53 @@ mraa_set_line_values(int line_handle, unsigned int num_lines, unsigned char inpu
 }
 
 int
-mraa_get_line_values(int line_handle, unsigned int num_lines, unsigned char output_values[])
+mraa_get_line_bits(int line_handle, uint64_t mask, uint64_t* bits)
 {
     int status;
-    struct gpiohandle_data __hdata;
+    struct gpio_v2_line_values __vdata;
+
+    __vdata.bits = 0;
+    __vdata.mask = mask;
 
-    status = _mraa_gpiod_ioctl(line_handle, GPIOHANDLE_GET_LINE_VALUES_IOCTL, &__hdata);
+    status = _mraa_gpiod_ioctl(line_handle, GPIO_V2_LINE_GET_VALUES_IOCTL, &__vdata);
     if (status < 0) {
         syslog(LOG_ERR, "[GPIOD_INTERFACE]: ioctl() fail");
         return status;
     }
 
-    memcpy(output_values, __hdata.values, num_lines * sizeof(unsigned char));
+    *bits = __vdata.bits;
+
+    return status;
+}
+
+int
+mraa_set_line_values(int line_handle, unsigned int num_lines, unsigned char input_values[])
+{
+    uint64_t bits = 0;
+
+    for (unsigned int i = 0; i < num_lines; ++i) {
+        if (input_values[i]) {
+            bits |= 1ULL << i;
+        }
+    }
+
+    return mraa_set_line_bits(line_handle, MRAA_GPIOD_LINES_MASK(num_lines), bits);
+}
+
+int
+mraa_get_line_values(int line_handle, unsigned int num_lines, unsigned char output_values[])
+{
+    int status;
+    uint64_t bits;
+
+    status = mraa_get_line_bits(line_handle, MRAA_GPIOD_LINES_MASK(num_lines), &bits);
+    if (status < 0) {
+        return status;
+    }
+
+    for (unsigned int i = 0; i < num_lines; ++i) {
+        output_values[i] = (bits >> i) & 1;
+    }
 
     return status;
 }
@@ -364,31 +428,31 @@ mraa_get_line_values(int line_handle, unsigned int num_lines, unsigned char outp
 mraa_boolean_t
 mraa_is_gpio_line_kernel_owned(mraa_gpiod_line_info* linfo)
 {
-    return (linfo->flags & GPIOLINE_FLAG_KERNEL);
+    return (linfo->flags & GPIO_V2_LINE_FLAG_USED) != 0;
 }
 
 mraa_boolean_t
 mraa_is_gpio_line_dir_out(mraa_gpiod_line_info* linfo)
 {
-    return (linfo->flags & GPIOLINE_FLAG_IS_OUT);
+    return (linfo->flags & GPIO_V2_LINE_FLAG_OUTPUT) != 0;
 }
 
 mraa_boolean_t
 mraa_is_gpio_line_active_low(mraa_gpiod_line_info* linfo)
 {
-    return (linfo->flags & GPIOLINE_FLAG_ACTIVE_LOW);
+    return (linfo->flags & GPIO_V2_LINE_FLAG_ACTIVE_LOW) != 0;
 }
 
 mraa_boolean_t
 mraa_is_gpio_line_open_drain(mraa_gpiod_line_info* linfo)
 {
-    return (linfo->flags & GPIOLINE_FLAG_OPEN_DRAIN);
+    return (linfo->flags & GPIO_V2_LINE_FLAG_OPEN_DRAIN) != 0;
 }
 
 mraa_boolean_t
 mraa_is_gpio_line_open_source(mraa_gpiod_line_info* linfo)
 {
-    return (linfo->flags & GPIOLINE_FLAG_OPEN_SOURCE);
+    return (linfo->flags & GPIO_V2_LINE_FLAG_OPEN_SOURCE) != 0;
 }
 
 static int
@@ -444,3 +508,34 @@ mraa_get_chip_infos(mraa_gpiod_chip_info*** cinfos)
 
     return num_chips;
 }
+
+mraa_boolean_t
+mraa_is_gpiod_v2_capable()
+{
+    int num_chips;
+    mraa_boolean_t capable = 0;
+    struct dirent** dirs;
+    mraa_gpiod_chip_info* cinfo;
+    mraa_gpiod_line_info linfo;
+
+    num_chips = scandir("/dev", &dirs, dir_filter, alphasort);
+    if (num_chips <= 0) {
+        return 0;
+    }
+
+    /* Kernels older than 5.10 only implement the v1 uAPI and reject v2 requests. */
+    cinfo = mraa_get_chip_info_by_name(dirs[0]->d_name);
+    if (cinfo) {
+        memset(&linfo, 0, sizeof linfo);
+        capable = ioctl(cinfo->chip_fd, GPIO_V2_GET_LINEINFO_IOCTL, &linfo) == 0;
+        close(cinfo->chip_fd);
+        free(cinfo);
+    }
+
+    for (int i = 0; i < num_chips; ++i) {
+        free(dirs[i]);
+    }
+    free(dirs);
+
+    return capable;
+}
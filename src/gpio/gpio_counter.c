@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "gpio/gpio_counter.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+mraa_gpio_counter_t
+mraa_gpio_counter_new(unsigned int num_lines, unsigned int window_ms)
+{
+    mraa_gpio_counter_t counter = calloc(1, sizeof(struct _gpio_counter));
+    if (counter == NULL) {
+        syslog(LOG_CRIT, "gpio: Failed to allocate memory for edge counter");
+        return NULL;
+    }
+
+    counter->lines = calloc(num_lines, sizeof(struct _gpio_counter_line));
+    if (counter->lines == NULL) {
+        syslog(LOG_CRIT, "gpio: Failed to allocate memory for edge counter");
+        free(counter);
+        return NULL;
+    }
+
+    if (window_ms == 0) {
+        window_ms = MRAA_GPIO_COUNTER_DEFAULT_WINDOW_MS;
+    }
+
+    counter->bucket_ns = (uint64_t) window_ms * 1000000ULL / MRAA_GPIO_COUNTER_BUCKETS;
+    counter->num_lines = num_lines;
+    pthread_mutex_init(&counter->lock, NULL);
+    mraa_gpio_counter_clear(counter);
+
+    return counter;
+}
+
+void
+mraa_gpio_counter_free(mraa_gpio_counter_t counter)
+{
+    if (counter == NULL) {
+        return;
+    }
+
+    pthread_mutex_destroy(&counter->lock);
+    free(counter->lines);
+    free(counter);
+}
+
+static inline void
+mraa_gpio_counter_write_begin(struct _gpio_counter_line* line)
+{
+    __atomic_store_n(&line->seq, line->seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static inline void
+mraa_gpio_counter_write_end(struct _gpio_counter_line* line)
+{
+    __atomic_store_n(&line->seq, line->seq + 1, __ATOMIC_RELEASE);
+}
+
+void
+mraa_gpio_counter_edge(mraa_gpio_counter_t counter, int line_idx, uint64_t timestamp_ns)
+{
+    if (line_idx < 0 || (unsigned int) line_idx >= counter->num_lines) {
+        return;
+    }
+
+    struct _gpio_counter_line* line = &counter->lines[line_idx];
+    uint64_t epoch = timestamp_ns / counter->bucket_ns;
+    unsigned int slot = epoch % MRAA_GPIO_COUNTER_BUCKETS;
+
+    pthread_mutex_lock(&counter->lock);
+    mraa_gpio_counter_write_begin(line);
+
+    line->count++;
+    // The slot last counted a full window ago, start it over
+    if (line->bucket_epoch[slot] != epoch) {
+        line->bucket_epoch[slot] = epoch;
+        line->bucket_count[slot] = 0;
+    }
+    line->bucket_count[slot]++;
+
+    mraa_gpio_counter_write_end(line);
+    pthread_mutex_unlock(&counter->lock);
+}
+
+void
+mraa_gpio_counter_clear(mraa_gpio_counter_t counter)
+{
+    uint64_t now = mraa_monotonic_ns();
+
+    pthread_mutex_lock(&counter->lock);
+    for (unsigned int i = 0; i < counter->num_lines; ++i) {
+        struct _gpio_counter_line* line = &counter->lines[i];
+
+        mraa_gpio_counter_write_begin(line);
+        line->count = 0;
+        line->start_ns = now;
+        memset(line->bucket_count, 0, sizeof(line->bucket_count));
+        mraa_gpio_counter_write_end(line);
+    }
+    pthread_mutex_unlock(&counter->lock);
+}
+
+mraa_result_t
+mraa_gpio_counter_get(mraa_gpio_counter_t counter, unsigned int line_idx, mraa_gpio_counter_value* value)
+{
+    return mraa_gpio_counter_get_at(counter, line_idx, mraa_monotonic_ns(), value);
+}
+
+mraa_result_t
+mraa_gpio_counter_get_at(mraa_gpio_counter_t counter, unsigned int line_idx, uint64_t now, mraa_gpio_counter_value* value)
+{
+    struct _gpio_counter_line* line;
+    struct _gpio_counter_line copy;
+    unsigned int seq;
+
+    if (line_idx >= counter->num_lines) {
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    line = &counter->lines[line_idx];
+    do {
+        while ((seq = __atomic_load_n(&line->seq, __ATOMIC_ACQUIRE)) & 1)
+            ;
+        memcpy(&copy, line, sizeof(copy));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while (__atomic_load_n(&line->seq, __ATOMIC_RELAXED) != seq);
+
+    uint64_t now_epoch = now / counter->bucket_ns;
+    uint64_t edges = 0;
+
+    // The current slice is partial, the window spans it and the full ones before
+    for (int i = 0; i < MRAA_GPIO_COUNTER_BUCKETS; ++i) {
+        if (copy.bucket_epoch[i] <= now_epoch && copy.bucket_epoch[i] + MRAA_GPIO_COUNTER_BUCKETS > now_epoch) {
+            edges += copy.bucket_count[i];
+        }
+    }
+
+    uint64_t window = (MRAA_GPIO_COUNTER_BUCKETS - 1) * counter->bucket_ns + (now - now_epoch * counter->bucket_ns);
+    if (now - copy.start_ns < window) {
+        window = now - copy.start_ns;
+    }
+
+    value->count = copy.count;
+    value->frequency_hz = window > 0 ? (double) edges * 1e9 / (double) window : 0.0;
+
+    return MRAA_SUCCESS;
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "gpio/gpio_debounce.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+mraa_gpio_debounce_t
+mraa_gpio_debounce_new(unsigned int num_lines, unsigned int stable_us, unsigned int vote)
+{
+    mraa_gpio_debounce_t debounce = calloc(1, sizeof(struct _gpio_debounce));
+    if (debounce == NULL) {
+        syslog(LOG_CRIT, "gpio: Failed to allocate memory for debounce filter");
+        return NULL;
+    }
+
+    debounce->lines = calloc(num_lines, sizeof(struct _gpio_debounce_line));
+    if (debounce->lines == NULL) {
+        syslog(LOG_CRIT, "gpio: Failed to allocate memory for debounce filter");
+        free(debounce);
+        return NULL;
+    }
+
+    debounce->timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    if (debounce->timer_fd < 0) {
+        syslog(LOG_ERR, "gpio: Failed to create debounce timer: %s", strerror(errno));
+        free(debounce->lines);
+        free(debounce);
+        return NULL;
+    }
+
+    debounce->stable_ns = (uint64_t) stable_us * 1000;
+    debounce->vote = vote;
+    debounce->num_lines = num_lines;
+    mraa_gpio_debounce_reset(debounce);
+
+    return debounce;
+}
+
+void
+mraa_gpio_debounce_free(mraa_gpio_debounce_t debounce)
+{
+    if (debounce == NULL) {
+        return;
+    }
+
+    close(debounce->timer_fd);
+    free(debounce->lines);
+    free(debounce);
+}
+
+static void
+mraa_gpio_debounce_arm(mraa_gpio_debounce_t debounce)
+{
+    struct itimerspec spec;
+    uint64_t deadline = 0;
+
+    for (unsigned int i = 0; i < debounce->num_lines; ++i) {
+        struct _gpio_debounce_line* line = &debounce->lines[i];
+
+        if (line->pending != -1 && (deadline == 0 || line->pending_since + debounce->stable_ns < deadline)) {
+            deadline = line->pending_since + debounce->stable_ns;
+        }
+    }
+
+    // A zero it_value disarms the timer
+    memset(&spec, 0, sizeof(spec));
+    if (deadline != 0) {
+        spec.it_value.tv_sec = deadline / 1000000000ULL;
+        spec.it_value.tv_nsec = deadline % 1000000000ULL;
+    }
+
+    if (timerfd_settime(debounce->timer_fd, TFD_TIMER_ABSTIME, &spec, NULL) != 0) {
+        syslog(LOG_ERR, "gpio: Failed to arm debounce timer: %s", strerror(errno));
+    }
+}
+
+void
+mraa_gpio_debounce_reset(mraa_gpio_debounce_t debounce)
+{
+    for (unsigned int i = 0; i < debounce->num_lines; ++i) {
+        debounce->lines[i].level = -1;
+        debounce->lines[i].pending = -1;
+    }
+
+    mraa_gpio_debounce_arm(debounce);
+}
+
+void
+mraa_gpio_debounce_edge(mraa_gpio_debounce_t debounce, int line, int level, uint64_t timestamp_ns)
+{
+    if (line < 0 || (unsigned int) line >= debounce->num_lines) {
+        return;
+    }
+
+    // Every bounce restarts the window
+    debounce->lines[line].pending = level;
+    debounce->lines[line].pending_since = timestamp_ns;
+
+    mraa_gpio_debounce_arm(debounce);
+}
+
+unsigned int
+mraa_gpio_debounce_expire(mraa_gpio_debounce_t debounce, mraa_gpio_debounce_ready* ready)
+{
+    uint64_t now, ticks;
+    unsigned int count = 0;
+
+    if (read(debounce->timer_fd, &ticks, sizeof(ticks)) < 0 && errno != EAGAIN) {
+        syslog(LOG_ERR, "gpio: Failed to clear debounce timer: %s", strerror(errno));
+    }
+
+    now = mraa_monotonic_ns();
+
+    for (unsigned int i = 0; i < debounce->num_lines; ++i) {
+        struct _gpio_debounce_line* line = &debounce->lines[i];
+
+        if (line->pending != -1 && line->pending_since + debounce->stable_ns <= now) {
+            ready[count].line = i;
+            ready[count].level = line->pending;
+            ready[count].since = line->pending_since;
+            count++;
+            line->pending = -1;
+        }
+    }
+
+    mraa_gpio_debounce_arm(debounce);
+
+    return count;
+}
+
+mraa_boolean_t
+mraa_gpio_debounce_commit(mraa_gpio_debounce_t debounce, int line, int level)
+{
+    if (debounce->lines[line].level == level) {
+        return 0;
+    }
+
+    debounce->lines[line].level = level;
+
+    return 1;
+}
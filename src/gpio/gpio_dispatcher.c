@@ -0,0 +1,410 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#define _GNU_SOURCE
+#include "gpio/gpio_dispatcher.h"
+#include "gpio.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+/* epoll events handled per worker wakeup. */
+#define MRAA_GPIO_DISPATCH_BATCH 32
+
+struct _gpio_dispatch_source;
+
+struct _gpio_dispatch_entry {
+    struct _gpio_dispatch_source* source;
+    int fd_idx;
+};
+
+/*
+ * Worker threads each own an epoll set. A context is bound to one worker for
+ * its lifetime, so its callback never runs concurrently with itself and the
+ * worker stays the single producer of the context's event ring.
+ */
+struct _gpio_dispatch_worker {
+    pthread_t thread;
+    int epoll_fd;
+    int wake_fd;
+    pthread_mutex_t lock; /**< held while dispatching a batch */
+    pthread_cond_t cycle_cond;
+    unsigned long cycle; /**< completed batches, lets unregister wait for quiescence */
+    unsigned int num_sources;
+    struct _gpio_dispatch_source* graveyard; /**< sources retired from inside a callback */
+    mraa_boolean_t stop;
+    mraa_boolean_t exited;
+};
+
+struct _gpio_dispatch_source {
+    mraa_gpio_context dev;
+    struct _gpio_dispatch_worker* worker;
+    int* fds;
+    int num_fds;
+    mraa_boolean_t sysfs; /**< sysfs value fds are owned, chardev handles are not */
+    mraa_boolean_t dead;
+    struct _gpio_dispatch_source* next_dead;
+    struct _gpio_dispatch_entry entries[];
+};
+
+static struct {
+    pthread_mutex_t lock;
+    struct _gpio_dispatch_worker* workers;
+    unsigned int num_workers;
+    uint64_t cpu_mask;
+    int priority;
+} dispatcher = { PTHREAD_MUTEX_INITIALIZER, NULL, 0, 0, 0 };
+
+static __thread struct _gpio_dispatch_worker* current_worker = NULL;
+
+static void
+mraa_gpio_dispatch_source_free(struct _gpio_dispatch_source* source)
+{
+    if (source->sysfs) {
+        for (int i = 0; i < source->num_fds; ++i) {
+            close(source->fds[i]);
+        }
+    }
+
+    free(source->fds);
+    free(source);
+}
+
+static void
+mraa_gpio_dispatch_kick(struct _gpio_dispatch_worker* worker)
+{
+    uint64_t one = 1;
+
+    if (write(worker->wake_fd, &one, sizeof(one)) != sizeof(one) && errno != EAGAIN) {
+        syslog(LOG_ERR, "gpio: dispatcher: failed to wake worker: %s", strerror(errno));
+    }
+}
+
+static void*
+mraa_gpio_dispatch_worker_run(void* arg)
+{
+    struct _gpio_dispatch_worker* worker = (struct _gpio_dispatch_worker*) arg;
+    struct epoll_event events[MRAA_GPIO_DISPATCH_BATCH];
+    mraa_boolean_t stop = 0;
+
+    current_worker = worker;
+
+    if (dispatcher.cpu_mask != 0) {
+        cpu_set_t set;
+
+        CPU_ZERO(&set);
+        for (int cpu = 0; cpu < 64; ++cpu) {
+            if (dispatcher.cpu_mask & (1ULL << cpu)) {
+                CPU_SET(cpu, &set);
+            }
+        }
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+            syslog(LOG_WARNING, "gpio: dispatcher: failed to set worker cpu affinity");
+        }
+    }
+
+    if (dispatcher.priority > 0 && mraa_set_scheduler(SCHED_FIFO, dispatcher.priority) != 0) {
+        syslog(LOG_WARNING, "gpio: dispatcher: failed to set SCHED_FIFO priority %d: %s",
+               dispatcher.priority, strerror(errno));
+    }
+
+    while (!stop) {
+        int num_events = epoll_wait(worker->epoll_fd, events, MRAA_GPIO_DISPATCH_BATCH, -1);
+        if (num_events < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            syslog(LOG_ERR, "gpio: dispatcher: epoll_wait failed: %s", strerror(errno));
+            stop = 1;
+            num_events = 0;
+        }
+
+        pthread_mutex_lock(&worker->lock);
+        for (int i = 0; i < num_events; ++i) {
+            struct _gpio_dispatch_entry* entry = events[i].data.ptr;
+
+            if (entry == NULL) {
+                uint64_t ticks;
+                read(worker->wake_fd, &ticks, sizeof(ticks));
+                continue;
+            }
+
+            /* The fd may have been removed after epoll_wait returned it. */
+            if (!entry->source->dead) {
+                _mraa_gpio_dispatch_event(entry->source->dev, entry->fd_idx,
+                                          entry->source->fds[entry->fd_idx]);
+            }
+        }
+
+        while (worker->graveyard != NULL) {
+            struct _gpio_dispatch_source* source = worker->graveyard;
+            worker->graveyard = source->next_dead;
+            mraa_gpio_dispatch_source_free(source);
+        }
+
+        worker->cycle++;
+        stop = stop || worker->stop;
+        if (stop) {
+            worker->exited = 1;
+        }
+        pthread_cond_broadcast(&worker->cycle_cond);
+        pthread_mutex_unlock(&worker->lock);
+    }
+
+    return NULL;
+}
+
+static void
+mraa_gpio_dispatch_worker_destroy(struct _gpio_dispatch_worker* worker)
+{
+    if (worker->epoll_fd >= 0) {
+        close(worker->epoll_fd);
+    }
+    if (worker->wake_fd >= 0) {
+        close(worker->wake_fd);
+    }
+    pthread_mutex_destroy(&worker->lock);
+    pthread_cond_destroy(&worker->cycle_cond);
+}
+
+static void
+mraa_gpio_dispatch_worker_join(struct _gpio_dispatch_worker* worker)
+{
+    pthread_mutex_lock(&worker->lock);
+    worker->stop = 1;
+    pthread_mutex_unlock(&worker->lock);
+
+    mraa_gpio_dispatch_kick(worker);
+    pthread_join(worker->thread, NULL);
+    mraa_gpio_dispatch_worker_destroy(worker);
+}
+
+mraa_result_t
+mraa_gpio_dispatcher_start(unsigned int num_workers, uint64_t cpu_mask, int priority)
+{
+    mraa_result_t ret = MRAA_SUCCESS;
+    struct epoll_event wake_event = { .events = EPOLLIN, .data.ptr = NULL };
+
+    if (num_workers == 0) {
+        syslog(LOG_ERR, "gpio: dispatcher: at least one worker is required");
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    pthread_mutex_lock(&dispatcher.lock);
+
+    if (dispatcher.workers != NULL) {
+        syslog(LOG_ERR, "gpio: dispatcher: already running");
+        ret = MRAA_ERROR_INVALID_RESOURCE;
+        goto out;
+    }
+
+    dispatcher.workers = calloc(num_workers, sizeof(struct _gpio_dispatch_worker));
+    if (dispatcher.workers == NULL) {
+        syslog(LOG_CRIT, "gpio: dispatcher: Failed to allocate memory for workers");
+        ret = MRAA_ERROR_NO_RESOURCES;
+        goto out;
+    }
+
+    dispatcher.cpu_mask = cpu_mask;
+    dispatcher.priority = priority;
+
+    for (unsigned int i = 0; i < num_workers; ++i) {
+        struct _gpio_dispatch_worker* worker = &dispatcher.workers[i];
+
+        pthread_mutex_init(&worker->lock, NULL);
+        pthread_cond_init(&worker->cycle_cond, NULL);
+        worker->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        worker->wake_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+        if (worker->epoll_fd < 0 || worker->wake_fd < 0 ||
+            epoll_ctl(worker->epoll_fd, EPOLL_CTL_ADD, worker->wake_fd, &wake_event) != 0 ||
+            pthread_create(&worker->thread, NULL, mraa_gpio_dispatch_worker_run, worker) != 0) {
+            syslog(LOG_ERR, "gpio: dispatcher: failed to start worker %u: %s", i, strerror(errno));
+            mraa_gpio_dispatch_worker_destroy(worker);
+            for (unsigned int j = 0; j < i; ++j) {
+                mraa_gpio_dispatch_worker_join(&dispatcher.workers[j]);
+            }
+            free(dispatcher.workers);
+            dispatcher.workers = NULL;
+            ret = MRAA_ERROR_NO_RESOURCES;
+            goto out;
+        }
+    }
+
+    dispatcher.num_workers = num_workers;
+
+out:
+    pthread_mutex_unlock(&dispatcher.lock);
+    return ret;
+}
+
+mraa_result_t
+mraa_gpio_dispatcher_stop()
+{
+    mraa_result_t ret = MRAA_SUCCESS;
+
+    pthread_mutex_lock(&dispatcher.lock);
+
+    if (dispatcher.workers == NULL) {
+        goto out;
+    }
+
+    for (unsigned int i = 0; i < dispatcher.num_workers; ++i) {
+        if (__atomic_load_n(&dispatcher.workers[i].num_sources, __ATOMIC_RELAXED) != 0) {
+            syslog(LOG_ERR, "gpio: dispatcher: interrupts are still registered");
+            ret = MRAA_ERROR_INVALID_RESOURCE;
+            goto out;
+        }
+    }
+
+    for (unsigned int i = 0; i < dispatcher.num_workers; ++i) {
+        mraa_gpio_dispatch_worker_join(&dispatcher.workers[i]);
+    }
+
+    free(dispatcher.workers);
+    dispatcher.workers = NULL;
+    dispatcher.num_workers = 0;
+
+out:
+    pthread_mutex_unlock(&dispatcher.lock);
+    return ret;
+}
+
+mraa_boolean_t
+mraa_gpio_dispatcher_running()
+{
+    mraa_boolean_t running;
+
+    pthread_mutex_lock(&dispatcher.lock);
+    running = dispatcher.workers != NULL;
+    pthread_mutex_unlock(&dispatcher.lock);
+
+    return running;
+}
+
+mraa_result_t
+mraa_gpio_dispatcher_register(mraa_gpio_context dev, int fds[], int num_fds, mraa_boolean_t sysfs)
+{
+    mraa_result_t ret = MRAA_SUCCESS;
+    struct _gpio_dispatch_worker* worker = NULL;
+    struct _gpio_dispatch_source* source;
+
+    source = calloc(1, sizeof(struct _gpio_dispatch_source) + num_fds * sizeof(struct _gpio_dispatch_entry));
+    if (source == NULL) {
+        syslog(LOG_CRIT, "gpio: dispatcher: Failed to allocate memory for interrupt source");
+        return MRAA_ERROR_NO_RESOURCES;
+    }
+
+    source->dev = dev;
+    source->fds = fds;
+    source->num_fds = num_fds;
+    source->sysfs = sysfs;
+
+    pthread_mutex_lock(&dispatcher.lock);
+
+    if (dispatcher.workers == NULL) {
+        syslog(LOG_ERR, "gpio: dispatcher: not running");
+        free(source);
+        ret = MRAA_ERROR_INVALID_RESOURCE;
+        goto out;
+    }
+
+    /* Balance contexts across workers. */
+    for (unsigned int i = 0; i < dispatcher.num_workers; ++i) {
+        if (worker == NULL || dispatcher.workers[i].num_sources < worker->num_sources) {
+            worker = &dispatcher.workers[i];
+        }
+    }
+    source->worker = worker;
+
+    for (int i = 0; i < num_fds; ++i) {
+        struct epoll_event event;
+
+        source->entries[i].source = source;
+        source->entries[i].fd_idx = i;
+        event.events = sysfs ? (EPOLLPRI | EPOLLERR) : EPOLLIN;
+        event.data.ptr = &source->entries[i];
+
+        if (epoll_ctl(worker->epoll_fd, EPOLL_CTL_ADD, fds[i], &event) != 0) {
+            syslog(LOG_ERR, "gpio: dispatcher: failed to watch fd %d: %s", fds[i], strerror(errno));
+            for (int j = 0; j < i; ++j) {
+                epoll_ctl(worker->epoll_fd, EPOLL_CTL_DEL, fds[j], NULL);
+            }
+            free(source);
+            ret = MRAA_ERROR_INVALID_RESOURCE;
+            goto out;
+        }
+    }
+
+    __atomic_fetch_add(&worker->num_sources, 1, __ATOMIC_RELAXED);
+    dev->dispatch_source = source;
+
+out:
+    pthread_mutex_unlock(&dispatcher.lock);
+    return ret;
+}
+
+mraa_result_t
+mraa_gpio_dispatcher_unregister(mraa_gpio_context dev)
+{
+    struct _gpio_dispatch_source* source = dev->dispatch_source;
+    struct _gpio_dispatch_worker* self = current_worker;
+
+    if (source == NULL) {
+        return MRAA_SUCCESS;
+    }
+
+    struct _gpio_dispatch_worker* worker = source->worker;
+    dev->dispatch_source = NULL;
+
+    /* Called from one of this context's callbacks: the batch being dispatched
+     * may still reference the source, free it once the batch is done. */
+    if (self == worker) {
+        for (int i = 0; i < source->num_fds; ++i) {
+            epoll_ctl(worker->epoll_fd, EPOLL_CTL_DEL, source->fds[i], NULL);
+        }
+        source->dead = 1;
+        source->next_dead = worker->graveyard;
+        worker->graveyard = source;
+        __atomic_fetch_sub(&worker->num_sources, 1, __ATOMIC_RELAXED);
+        return MRAA_SUCCESS;
+    }
+
+    /* Let our own worker make progress while waiting on another one. */
+    if (self != NULL) {
+        pthread_mutex_unlock(&self->lock);
+    }
+
+    pthread_mutex_lock(&worker->lock);
+    for (int i = 0; i < source->num_fds; ++i) {
+        epoll_ctl(worker->epoll_fd, EPOLL_CTL_DEL, source->fds[i], NULL);
+    }
+    source->dead = 1;
+
+    /* An epoll_wait started before the removal may still return the fds,
+     * the batch it belongs to is over once the cycle count moves. */
+    unsigned long target = worker->cycle + 1;
+    mraa_gpio_dispatch_kick(worker);
+    while (worker->cycle < target && !worker->exited) {
+        pthread_cond_wait(&worker->cycle_cond, &worker->lock);
+    }
+    pthread_mutex_unlock(&worker->lock);
+
+    if (self != NULL) {
+        pthread_mutex_lock(&self->lock);
+    }
+
+    __atomic_fetch_sub(&worker->num_sources, 1, __ATOMIC_RELAXED);
+    mraa_gpio_dispatch_source_free(source);
+
+    return MRAA_SUCCESS;
+}
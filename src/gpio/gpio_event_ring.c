@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "gpio/gpio_event_ring.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+/* Readers of every ring, so closing a context can wait for the ones still blocked on it */
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t idle;
+} readers = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER };
+
+mraa_gpio_event_ring_t
+mraa_gpio_event_ring_new(unsigned int size)
+{
+    if (size == 0 || (size & (size - 1)) != 0) {
+        syslog(LOG_ERR, "gpio: event ring size %u is not a power of two", size);
+        return NULL;
+    }
+
+    mraa_gpio_event_ring_t ring = calloc(1, sizeof(struct _gpio_event_ring));
+    if (ring == NULL) {
+        syslog(LOG_CRIT, "gpio: Failed to allocate memory for event ring");
+        return NULL;
+    }
+
+    ring->slots = calloc(size, sizeof(mraa_gpio_capture_event));
+    if (ring->slots == NULL) {
+        syslog(LOG_CRIT, "gpio: Failed to allocate memory for event ring");
+        free(ring);
+        return NULL;
+    }
+
+    ring->wake_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (ring->wake_fd < 0) {
+        syslog(LOG_ERR, "gpio: Failed to create event ring eventfd: %s", strerror(errno));
+        free(ring->slots);
+        free(ring);
+        return NULL;
+    }
+
+    ring->size = size;
+    pthread_mutex_init(&ring->consume, NULL);
+
+    return ring;
+}
+
+void
+mraa_gpio_event_ring_free(mraa_gpio_event_ring_t ring)
+{
+    if (ring == NULL) {
+        return;
+    }
+
+    close(ring->wake_fd);
+    pthread_mutex_destroy(&ring->consume);
+    free(ring->slots);
+    free(ring);
+}
+
+int
+mraa_gpio_event_ring_push(mraa_gpio_event_ring_t ring, const mraa_gpio_capture_event* event)
+{
+    unsigned int head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    unsigned int tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+
+    /* Keep what is already queued, the newest event is the one lost. */
+    if (head - tail == ring->size) {
+        __atomic_fetch_add(&ring->dropped, 1, __ATOMIC_RELAXED);
+        return -1;
+    }
+
+    ring->slots[head & (ring->size - 1)] = *event;
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+
+    return 0;
+}
+
+void
+mraa_gpio_event_ring_add_dropped(mraa_gpio_event_ring_t ring, unsigned int count)
+{
+    __atomic_fetch_add(&ring->dropped, count, __ATOMIC_RELAXED);
+}
+
+unsigned int
+mraa_gpio_event_ring_dropped(mraa_gpio_event_ring_t ring)
+{
+    return __atomic_load_n(&ring->dropped, __ATOMIC_RELAXED);
+}
+
+void
+mraa_gpio_event_ring_notify(mraa_gpio_event_ring_t ring)
+{
+    uint64_t one = 1;
+
+    if (write(ring->wake_fd, &one, sizeof(one)) != sizeof(one) && errno != EAGAIN) {
+        syslog(LOG_ERR, "gpio: Failed to signal event ring: %s", strerror(errno));
+    }
+}
+
+unsigned int
+mraa_gpio_event_ring_pop(mraa_gpio_event_ring_t ring, mraa_gpio_capture_event* buf, unsigned int max)
+{
+    pthread_mutex_lock(&ring->consume);
+    unsigned int tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    unsigned int head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    unsigned int count = head - tail;
+
+    if (count > max) {
+        count = max;
+    }
+
+    for (unsigned int i = 0; i < count; ++i) {
+        buf[i] = ring->slots[(tail + i) & (ring->size - 1)];
+    }
+    __atomic_store_n(&ring->tail, tail + count, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&ring->consume);
+
+    // The wakeup of these events may have been taken by this reader, leave one for the others
+    if (head - tail > count) {
+        mraa_gpio_event_ring_notify(ring);
+    }
+
+    return count;
+}
+
+int
+mraa_gpio_event_ring_wait(mraa_gpio_event_ring_t ring, mraa_gpio_capture_event* buf, unsigned int max, int timeout_ms)
+{
+    long long deadline = (long long) (mraa_monotonic_ns() / 1000000) + timeout_ms;
+    unsigned int count = mraa_gpio_event_ring_pop(ring, buf, max);
+    struct pollfd pfd = { .fd = ring->wake_fd, .events = POLLIN };
+    uint64_t ticks;
+
+    /* The eventfd may carry stale wakeups for events drained earlier, so
+     * keep waiting until something is actually queued or time runs out. */
+    while (count == 0 && timeout_ms != 0) {
+        int remaining = -1;
+
+        // Pass the wakeup on, the eventfd is consumed by whichever reader gets it first
+        if (__atomic_load_n(&ring->closing, __ATOMIC_ACQUIRE)) {
+            mraa_gpio_event_ring_notify(ring);
+            return -1;
+        }
+
+        if (timeout_ms > 0) {
+            long long left = deadline - (long long) (mraa_monotonic_ns() / 1000000);
+            if (left <= 0) {
+                break;
+            }
+            remaining = (int) left;
+        }
+
+        int ret = poll(&pfd, 1, remaining);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            syslog(LOG_ERR, "gpio: Failed to wait for events: %s", strerror(errno));
+            return -1;
+        }
+        if (ret == 0) {
+            break;
+        }
+
+        if (read(ring->wake_fd, &ticks, sizeof(ticks)) < 0 && errno != EAGAIN) {
+            syslog(LOG_ERR, "gpio: Failed to clear event ring signal: %s", strerror(errno));
+            return -1;
+        }
+
+        count = mraa_gpio_event_ring_pop(ring, buf, max);
+    }
+
+    return (int) count;
+}
+
+mraa_gpio_event_ring_t
+mraa_gpio_event_ring_enter(mraa_gpio_event_ring_t* slot)
+{
+    pthread_mutex_lock(&readers.lock);
+    mraa_gpio_event_ring_t ring = *slot;
+    if (ring != NULL) {
+        ring->readers++;
+    }
+    pthread_mutex_unlock(&readers.lock);
+
+    return ring;
+}
+
+void
+mraa_gpio_event_ring_leave(mraa_gpio_event_ring_t ring)
+{
+    pthread_mutex_lock(&readers.lock);
+    if (--ring->readers == 0) {
+        pthread_cond_broadcast(&readers.idle);
+    }
+    pthread_mutex_unlock(&readers.lock);
+}
+
+void
+mraa_gpio_event_ring_close(mraa_gpio_event_ring_t* slot)
+{
+    pthread_mutex_lock(&readers.lock);
+    mraa_gpio_event_ring_t ring = *slot;
+    *slot = NULL;
+    if (ring == NULL) {
+        pthread_mutex_unlock(&readers.lock);
+        return;
+    }
+
+    // New readers no longer find the ring, wake the blocked ones and let them leave
+    __atomic_store_n(&ring->closing, 1, __ATOMIC_RELEASE);
+    mraa_gpio_event_ring_notify(ring);
+    while (ring->readers > 0) {
+        pthread_cond_wait(&readers.idle, &readers.lock);
+    }
+    pthread_mutex_unlock(&readers.lock);
+
+    mraa_gpio_event_ring_free(ring);
+}
@@ -0,0 +1,485 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "gpio/gpio_mmap.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+static pthread_mutex_t mraa_gpio_mmap_registry_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct _gpio_mmap_region* mraa_gpio_mmap_regions = NULL;
+
+struct _gpio_mmap_region*
+mraa_gpio_mmap_region_acquire(const mraa_gpio_mmap_desc_t* desc)
+{
+    uint64_t page = (uint64_t) sysconf(_SC_PAGESIZE);
+    uint64_t base = desc->base & ~(page - 1);
+    size_t size = (size_t) (((desc->base - base) + desc->size + page - 1) & ~(page - 1));
+    struct _gpio_mmap_region* region;
+
+    pthread_mutex_lock(&mraa_gpio_mmap_registry_lock);
+
+    for (region = mraa_gpio_mmap_regions; region != NULL; region = region->next) {
+        if (region->base == base && region->size >= size && strcmp(region->mem_dev, desc->mem_dev) == 0) {
+            region->refcount++;
+            pthread_mutex_unlock(&mraa_gpio_mmap_registry_lock);
+            return region;
+        }
+    }
+
+    region = calloc(1, sizeof(struct _gpio_mmap_region));
+    if (region == NULL) {
+        syslog(LOG_CRIT, "gpio: mmap: Failed to allocate memory for region");
+        pthread_mutex_unlock(&mraa_gpio_mmap_registry_lock);
+        return NULL;
+    }
+
+    region->fd = open(desc->mem_dev, O_RDWR | O_SYNC | O_CLOEXEC);
+    if (region->fd < 0) {
+        syslog(LOG_ERR, "gpio: mmap: unable to open %s: %s", desc->mem_dev, strerror(errno));
+        free(region);
+        pthread_mutex_unlock(&mraa_gpio_mmap_registry_lock);
+        return NULL;
+    }
+
+    region->map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, region->fd, (off_t) base);
+    if (region->map == MAP_FAILED) {
+        syslog(LOG_ERR, "gpio: mmap: failed to map %s at 0x%llx: %s", desc->mem_dev,
+               (unsigned long long) base, strerror(errno));
+        close(region->fd);
+        free(region);
+        pthread_mutex_unlock(&mraa_gpio_mmap_registry_lock);
+        return NULL;
+    }
+
+    strncpy(region->mem_dev, desc->mem_dev, sizeof(region->mem_dev) - 1);
+    region->base = base;
+    region->size = size;
+    region->refcount = 1;
+    pthread_mutex_init(&region->lock, NULL);
+    region->next = mraa_gpio_mmap_regions;
+    mraa_gpio_mmap_regions = region;
+
+    pthread_mutex_unlock(&mraa_gpio_mmap_registry_lock);
+
+    return region;
+}
+
+void
+mraa_gpio_mmap_region_release(struct _gpio_mmap_region* region)
+{
+    struct _gpio_mmap_region** it;
+
+    if (region == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&mraa_gpio_mmap_registry_lock);
+
+    if (--region->refcount > 0) {
+        pthread_mutex_unlock(&mraa_gpio_mmap_registry_lock);
+        return;
+    }
+
+    for (it = &mraa_gpio_mmap_regions; *it != NULL; it = &(*it)->next) {
+        if (*it == region) {
+            *it = region->next;
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&mraa_gpio_mmap_registry_lock);
+
+    munmap(region->map, region->size);
+    close(region->fd);
+    pthread_mutex_destroy(&region->lock);
+    free(region);
+}
+
+void
+mraa_gpio_mmap_apply(struct _gpio_mmap_port* port, const uint32_t set_bits[], const uint32_t clear_bits[])
+{
+    for (unsigned int b = 0; b < port->num_banks; ++b) {
+        struct _gpio_mmap_bank* bank = &port->banks[b];
+
+        if (bank->set != NULL && bank->clear != NULL) {
+            if (set_bits[b]) {
+                *bank->set = set_bits[b];
+            }
+            if (clear_bits[b]) {
+                *bank->clear = clear_bits[b];
+            }
+            continue;
+        }
+
+        if (!(set_bits[b] | clear_bits[b])) {
+            continue;
+        }
+
+        // No dedicated registers, other lines share the latch
+        pthread_mutex_lock(&port->region->lock);
+        *bank->data = (*bank->data | set_bits[b]) & ~clear_bits[b];
+        pthread_mutex_unlock(&port->region->lock);
+    }
+}
+
+static mraa_result_t
+mraa_gpio_mmap_write(mraa_gpio_context dev, int value)
+{
+    struct _gpio_mmap_port* port = dev->mmap_port;
+    struct _gpio_mmap_bank* bank = &port->banks[port->pin_bank[0]];
+    uint32_t mask = port->pin_mask[0];
+
+    if (value && bank->set != NULL) {
+        *bank->set = mask;
+        return MRAA_SUCCESS;
+    }
+    if (!value && bank->clear != NULL) {
+        *bank->clear = mask;
+        return MRAA_SUCCESS;
+    }
+
+    pthread_mutex_lock(&port->region->lock);
+    if (value) {
+        *bank->data |= mask;
+    } else {
+        *bank->data &= ~mask;
+    }
+    pthread_mutex_unlock(&port->region->lock);
+
+    return MRAA_SUCCESS;
+}
+
+static int
+mraa_gpio_mmap_read(mraa_gpio_context dev)
+{
+    struct _gpio_mmap_port* port = dev->mmap_port;
+
+    return (*port->banks[port->pin_bank[0]].level & port->pin_mask[0]) ? 1 : 0;
+}
+
+mraa_result_t
+mraa_gpio_mmap_write_multi(mraa_gpio_context dev, int input_values[])
+{
+    struct _gpio_mmap_port* port = dev->mmap_port;
+    uint32_t set_bits[port->num_banks];
+    uint32_t clear_bits[port->num_banks];
+
+    memset(set_bits, 0, sizeof(set_bits));
+    memset(clear_bits, 0, sizeof(clear_bits));
+
+    for (unsigned int i = 0; i < port->num_pins; ++i) {
+        if (input_values[i]) {
+            set_bits[port->pin_bank[i]] |= port->pin_mask[i];
+        } else {
+            clear_bits[port->pin_bank[i]] |= port->pin_mask[i];
+        }
+    }
+
+    mraa_gpio_mmap_apply(port, set_bits, clear_bits);
+
+    return MRAA_SUCCESS;
+}
+
+mraa_result_t
+mraa_gpio_mmap_write_mask(mraa_gpio_context dev, uint64_t values, uint64_t mask)
+{
+    struct _gpio_mmap_port* port = dev->mmap_port;
+    uint32_t set_bits[port->num_banks];
+    uint32_t clear_bits[port->num_banks];
+
+    memset(set_bits, 0, sizeof(set_bits));
+    memset(clear_bits, 0, sizeof(clear_bits));
+
+    for (unsigned int i = 0; i < port->num_pins && i < 64; ++i) {
+        if (!(mask & (1ULL << i))) {
+            continue;
+        }
+        if (values & (1ULL << i)) {
+            set_bits[port->pin_bank[i]] |= port->pin_mask[i];
+        } else {
+            clear_bits[port->pin_bank[i]] |= port->pin_mask[i];
+        }
+    }
+
+    mraa_gpio_mmap_apply(port, set_bits, clear_bits);
+
+    return MRAA_SUCCESS;
+}
+
+mraa_result_t
+mraa_gpio_mmap_read_multi(mraa_gpio_context dev, int output_values[])
+{
+    struct _gpio_mmap_port* port = dev->mmap_port;
+    uint32_t levels[port->num_banks];
+
+    // One load per bank so all pins of a bank are sampled at the same time
+    for (unsigned int b = 0; b < port->num_banks; ++b) {
+        levels[b] = *port->banks[b].level;
+    }
+
+    for (unsigned int i = 0; i < port->num_pins; ++i) {
+        output_values[i] = (levels[port->pin_bank[i]] & port->pin_mask[i]) ? 1 : 0;
+    }
+
+    return MRAA_SUCCESS;
+}
+
+static volatile uint32_t*
+mraa_gpio_mmap_reg(struct _gpio_mmap_region* region, unsigned int block_offset, int reg_offset)
+{
+    if (reg_offset < 0) {
+        return NULL;
+    }
+
+    return (volatile uint32_t*) (region->map + block_offset + reg_offset);
+}
+
+static void
+mraa_gpio_mmap_port_free(struct _gpio_mmap_port* port)
+{
+    mraa_gpio_mmap_region_release(port->region);
+    free(port->banks);
+    free(port->pin_bank);
+    free(port->pin_mask);
+    free(port);
+}
+
+/* Os gpio numbers of the pins of a context, in the order of the multi pin calls. */
+static mraa_result_t
+mraa_gpio_mmap_get_lines(mraa_gpio_context dev, int** lines, int* count)
+{
+    *count = 0;
+    if (dev->gpio_group != NULL) {
+        *count = dev->num_pins;
+    } else {
+        for (mraa_gpio_context it = dev; it != NULL; it = it->next) {
+            (*count)++;
+        }
+    }
+
+    *lines = malloc(*count * sizeof(int));
+    if (*lines == NULL) {
+        syslog(LOG_CRIT, "gpio%i: mmap: Failed to allocate memory for context", dev->pin);
+        return MRAA_ERROR_NO_RESOURCES;
+    }
+
+    if (dev->gpio_group != NULL) {
+        for (int i = 0; i < *count; ++i) {
+            struct _gpio_group* group = &dev->gpio_group[dev->pin_to_gpio_table[i]];
+            unsigned int line = group->gpio_lines[dev->pin_to_slot_table[i]];
+            int pin = dev->provided_pins[i];
+
+            // Contexts opened by line name or on a sub platform hold no pin of this board
+            if (pin < 0 || pin >= plat->phy_pin_count || plat->pins[pin].gpio.gpio_chip != group->gpio_chip ||
+                plat->pins[pin].gpio.gpio_line != line) {
+                syslog(LOG_ERR, "gpio%i: mmap: line %u of chip %u is not a board pin", dev->pin, line, group->gpio_chip);
+                return MRAA_ERROR_INVALID_PARAMETER;
+            }
+            (*lines)[i] = plat->pins[pin].gpio.pinmap;
+        }
+    } else {
+        mraa_gpio_context it = dev;
+        for (int i = 0; i < *count; ++i, it = it->next) {
+            (*lines)[i] = it->pin;
+        }
+    }
+
+    return MRAA_SUCCESS;
+}
+
+mraa_result_t
+mraa_gpio_mmap_setup(mraa_gpio_context dev, const mraa_gpio_mmap_desc_t* desc, mraa_boolean_t en)
+{
+    struct _gpio_mmap_port* port;
+    mraa_result_t ret = MRAA_ERROR_NO_RESOURCES;
+    int* lines = NULL;
+    int count;
+
+    if (en == 0) {
+        if (dev->mmap_port == NULL) {
+            syslog(LOG_ERR, "gpio%i: mmap: can't disable disabled mmap gpio", dev->pin);
+            return MRAA_ERROR_INVALID_PARAMETER;
+        }
+        dev->mmap_write = NULL;
+        dev->mmap_read = NULL;
+        mraa_gpio_mmap_port_free(dev->mmap_port);
+        dev->mmap_port = NULL;
+        dev->mmap_generation++;
+        return MRAA_SUCCESS;
+    }
+
+    if (dev->mmap_port != NULL) {
+        syslog(LOG_ERR, "gpio%i: mmap: can't enable enabled mmap gpio", dev->pin);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    if (desc->data_offset < 0 && (desc->set_offset < 0 || desc->clear_offset < 0)) {
+        syslog(LOG_ERR, "gpio: mmap: no way to drive lines, need a data register or set and clear");
+        return MRAA_ERROR_FEATURE_NOT_IMPLEMENTED;
+    }
+    if (desc->data_offset < 0 && desc->level_offset < 0) {
+        syslog(LOG_ERR, "gpio: mmap: no way to read lines, need a data or level register");
+        return MRAA_ERROR_FEATURE_NOT_IMPLEMENTED;
+    }
+    if (desc->lines_per_bank == 0 || desc->lines_per_bank > 32) {
+        syslog(LOG_ERR, "gpio: mmap: %u lines per bank is not supported", desc->lines_per_bank);
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+
+    int highest = desc->set_offset;
+    if (desc->clear_offset > highest)
+        highest = desc->clear_offset;
+    if (desc->data_offset > highest)
+        highest = desc->data_offset;
+    if (desc->level_offset > highest)
+        highest = desc->level_offset;
+    if (desc->dir_offset > highest)
+        highest = desc->dir_offset;
+
+    ret = mraa_gpio_mmap_get_lines(dev, &lines, &count);
+    if (ret != MRAA_SUCCESS) {
+        free(lines);
+        return ret;
+    }
+    ret = MRAA_ERROR_NO_RESOURCES;
+
+    port = calloc(1, sizeof(struct _gpio_mmap_port));
+    if (port == NULL) {
+        syslog(LOG_CRIT, "gpio%i: mmap: Failed to allocate memory for context", dev->pin);
+        free(lines);
+        return MRAA_ERROR_NO_RESOURCES;
+    }
+    port->num_pins = count;
+    port->dir_out_high = desc->dir_out_high ? 1 : 0;
+    port->banks = calloc(count, sizeof(struct _gpio_mmap_bank));
+    port->pin_bank = calloc(count, sizeof(unsigned int));
+    port->pin_mask = calloc(count, sizeof(uint32_t));
+    if (port->banks == NULL || port->pin_bank == NULL || port->pin_mask == NULL) {
+        syslog(LOG_CRIT, "gpio%i: mmap: Failed to allocate memory for context", dev->pin);
+        goto fail;
+    }
+
+    // Group the pins by bank first, all checks happen before mapping anything
+    for (int i = 0; i < count; ++i) {
+        int offset = lines[i] - desc->line_base;
+        unsigned int index, b;
+
+        if (offset < 0) {
+            syslog(LOG_ERR, "gpio%i: mmap: line is not handled by %s", lines[i], desc->mem_dev);
+            ret = MRAA_ERROR_INVALID_RESOURCE;
+            goto fail;
+        }
+
+        index = offset / desc->lines_per_bank;
+        if (index * desc->bank_stride + highest + sizeof(uint32_t) > desc->size) {
+            syslog(LOG_ERR, "gpio%i: mmap: line is outside of the %u byte register block", lines[i], desc->size);
+            ret = MRAA_ERROR_INVALID_RESOURCE;
+            goto fail;
+        }
+
+        for (b = 0; b < port->num_banks && port->banks[b].index != index; ++b)
+            ;
+        if (b == port->num_banks) {
+            port->banks[b].index = index;
+            port->num_banks++;
+        }
+
+        port->pin_bank[i] = b;
+        port->pin_mask[i] = 1u << (offset % desc->lines_per_bank);
+        port->banks[b].mask |= port->pin_mask[i];
+    }
+
+    port->region = mraa_gpio_mmap_region_acquire(desc);
+    if (port->region == NULL) {
+        goto fail;
+    }
+
+    // The region starts on a page boundary below the register block
+    for (unsigned int b = 0; b < port->num_banks; ++b) {
+        struct _gpio_mmap_bank* bank = &port->banks[b];
+        unsigned int block_offset =
+        (unsigned int) (desc->base - port->region->base) + bank->index * desc->bank_stride;
+
+        bank->set = mraa_gpio_mmap_reg(port->region, block_offset, desc->set_offset);
+        bank->clear = mraa_gpio_mmap_reg(port->region, block_offset, desc->clear_offset);
+        bank->data = mraa_gpio_mmap_reg(port->region, block_offset, desc->data_offset);
+        bank->level = mraa_gpio_mmap_reg(port->region, block_offset, desc->level_offset);
+        bank->dir = mraa_gpio_mmap_reg(port->region, block_offset, desc->dir_offset);
+        if (bank->level == NULL) {
+            bank->level = bank->data;
+        }
+    }
+
+    free(lines);
+
+    dev->mmap_port = port;
+    dev->mmap_generation++;
+    dev->mmap_write = &mraa_gpio_mmap_write;
+    dev->mmap_read = &mraa_gpio_mmap_read;
+
+    return MRAA_SUCCESS;
+
+fail:
+    free(lines);
+    free(port->banks);
+    free(port->pin_bank);
+    free(port->pin_mask);
+    free(port);
+    return ret;
+}
+
+mraa_result_t
+mraa_gpio_mmap_dir(mraa_gpio_context dev, mraa_gpio_dir_t dir)
+{
+    struct _gpio_mmap_port* port = dev->mmap_port;
+    uint32_t bits[port->num_banks];
+    uint32_t none[port->num_banks];
+    mraa_boolean_t output;
+
+    switch (dir) {
+        case MRAA_GPIO_OUT_HIGH:
+        case MRAA_GPIO_OUT_LOW:
+            // Latch the level before the drivers are enabled
+            for (unsigned int b = 0; b < port->num_banks; ++b) {
+                bits[b] = port->banks[b].mask;
+                none[b] = 0;
+            }
+            if (dir == MRAA_GPIO_OUT_HIGH) {
+                mraa_gpio_mmap_apply(port, bits, none);
+            } else {
+                mraa_gpio_mmap_apply(port, none, bits);
+            }
+            output = 1;
+            break;
+        case MRAA_GPIO_OUT:
+            output = 1;
+            break;
+        case MRAA_GPIO_IN:
+            output = 0;
+            break;
+        default:
+            return MRAA_ERROR_FEATURE_NOT_IMPLEMENTED;
+    }
+
+    pthread_mutex_lock(&port->region->lock);
+    for (unsigned int b = 0; b < port->num_banks; ++b) {
+        struct _gpio_mmap_bank* bank = &port->banks[b];
+
+        if (output == port->dir_out_high) {
+            *bank->dir |= bank->mask;
+        } else {
+            *bank->dir &= ~bank->mask;
+        }
+    }
+    pthread_mutex_unlock(&port->region->lock);
+
+    return MRAA_SUCCESS;
+}
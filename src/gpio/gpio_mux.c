@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "gpio/gpio_mux.h"
+#include "gpio/gpio_shadow.h"
+#include "gpio.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct _gpio_mux_handle {
+    unsigned int pin;
+    mraa_gpio_context dev;
+    struct _gpio_mux_handle* next;
+};
+
+/* One lock for the plan cache and the pool, mux setup also must not interleave. */
+static struct {
+    pthread_mutex_t lock;
+    struct _gpio_mux_plan* plans;
+    struct _gpio_mux_handle* handles;
+} mux = { PTHREAD_MUTEX_INITIALIZER, NULL, NULL };
+
+static void
+mraa_gpio_mux_plan_add(mraa_gpio_mux_plan_t plan, unsigned int pin, mraa_mux_op_t op, unsigned int value)
+{
+    struct _gpio_mux_step* last = plan->num_steps > 0 ? &plan->steps[plan->num_steps - 1] : NULL;
+
+    // Board tables repeat a command when two functions share a mux
+    if (last != NULL && last->pin == pin && last->op == op && last->value == value) {
+        return;
+    }
+
+    // A plain output followed by its level is a single OUT_HIGH / OUT_LOW write
+    if (op == MRAA_MUX_OP_WRITE && last != NULL && last->pin == pin && last->op == MRAA_MUX_OP_DIR &&
+        last->value == MRAA_GPIO_OUT) {
+        last->op = MRAA_MUX_OP_OUT;
+        last->value = value;
+        return;
+    }
+
+    plan->steps[plan->num_steps].pin = pin;
+    plan->steps[plan->num_steps].op = op;
+    plan->steps[plan->num_steps].value = value;
+    plan->num_steps++;
+}
+
+static mraa_gpio_mux_plan_t
+mraa_gpio_mux_plan_compile(const mraa_pin_t* meta)
+{
+    mraa_gpio_mux_plan_t plan = calloc(1, sizeof(struct _gpio_mux_plan));
+    if (plan == NULL) {
+        syslog(LOG_CRIT, "mux: Failed to allocate memory for mux plan");
+        return NULL;
+    }
+
+    plan->mux_total = meta->mux_total;
+    memcpy(plan->mux, meta->mux, meta->mux_total * sizeof(mraa_mux_t));
+
+    for (unsigned int mi = 0; mi < meta->mux_total; mi++) {
+        const mraa_mux_t* m = &meta->mux[mi];
+
+        switch (m->pincmd) {
+            case PINCMD_UNDEFINED: // used for backward compatibility
+                mraa_gpio_mux_plan_add(plan, m->pin, MRAA_MUX_OP_OUT_LEGACY, m->value);
+                break;
+            case PINCMD_SET_VALUE:
+                mraa_gpio_mux_plan_add(plan, m->pin, MRAA_MUX_OP_WRITE, m->value);
+                break;
+            case PINCMD_SET_DIRECTION:
+                mraa_gpio_mux_plan_add(plan, m->pin, MRAA_MUX_OP_DIR, m->value);
+                break;
+            case PINCMD_SET_IN_VALUE:
+                mraa_gpio_mux_plan_add(plan, m->pin, MRAA_MUX_OP_IN_VALUE, m->value);
+                break;
+            case PINCMD_SET_OUT_VALUE:
+                mraa_gpio_mux_plan_add(plan, m->pin, MRAA_MUX_OP_OUT, m->value);
+                break;
+            case PINCMD_SET_MODE:
+                mraa_gpio_mux_plan_add(plan, m->pin, MRAA_MUX_OP_MODE, m->value);
+                break;
+            case PINCMD_SKIP:
+                break;
+            default:
+                syslog(LOG_NOTICE, "mraa_setup_mux_mapped: wrong command %d on pin %d with value %d",
+                       m->pincmd, m->pin, m->value);
+                break;
+        }
+    }
+
+    return plan;
+}
+
+mraa_gpio_mux_plan_t
+mraa_gpio_mux_plan_get(const mraa_pin_t* meta)
+{
+    mraa_gpio_mux_plan_t plan;
+    unsigned int total = meta->mux_total;
+
+    if (total > sizeof(meta->mux) / sizeof(meta->mux[0])) {
+        syslog(LOG_ERR, "mux: %u muxes given, at most %u supported", total,
+               (unsigned int) (sizeof(meta->mux) / sizeof(meta->mux[0])));
+        return NULL;
+    }
+
+    pthread_mutex_lock(&mux.lock);
+    for (plan = mux.plans; plan != NULL; plan = plan->next) {
+        if (plan->mux_total == total && memcmp(plan->mux, meta->mux, total * sizeof(mraa_mux_t)) == 0) {
+            break;
+        }
+    }
+
+    if (plan == NULL) {
+        plan = mraa_gpio_mux_plan_compile(meta);
+        if (plan != NULL) {
+            plan->next = mux.plans;
+            mux.plans = plan;
+        }
+    }
+    pthread_mutex_unlock(&mux.lock);
+
+    return plan;
+}
+
+/* Pooled contexts are not owners, closing them never unexports the mux. */
+static mraa_gpio_context
+mraa_gpio_mux_handle(unsigned int pin)
+{
+    struct _gpio_mux_handle* handle;
+
+    for (handle = mux.handles; handle != NULL; handle = handle->next) {
+        if (handle->pin == pin) {
+            return handle->dev;
+        }
+    }
+
+    handle = calloc(1, sizeof(struct _gpio_mux_handle));
+    if (handle == NULL) {
+        syslog(LOG_CRIT, "mux: Failed to allocate memory for mux handle");
+        return NULL;
+    }
+
+    handle->dev = mraa_gpio_init_raw(pin);
+    if (handle->dev == NULL) {
+        free(handle);
+        return NULL;
+    }
+    mraa_gpio_owner(handle->dev, 0);
+
+    handle->pin = pin;
+    handle->next = mux.handles;
+    mux.handles = handle;
+
+    return handle->dev;
+}
+
+static void
+mraa_gpio_mux_handle_drop(unsigned int pin)
+{
+    struct _gpio_mux_handle** it = &mux.handles;
+
+    while (*it != NULL) {
+        if ((*it)->pin == pin) {
+            struct _gpio_mux_handle* handle = *it;
+            *it = handle->next;
+            mraa_gpio_close(handle->dev);
+            free(handle);
+            return;
+        }
+        it = &(*it)->next;
+    }
+}
+
+static mraa_result_t
+mraa_gpio_mux_step_run(mraa_gpio_context dev, const struct _gpio_mux_step* step)
+{
+    mraa_result_t ret;
+    mraa_gpio_dir_t out = step->value ? MRAA_GPIO_OUT_HIGH : MRAA_GPIO_OUT_LOW;
+
+    switch (step->op) {
+        case MRAA_MUX_OP_WRITE:
+            return mraa_gpio_write(dev, step->value);
+        case MRAA_MUX_OP_DIR:
+            return mraa_gpio_dir(dev, step->value);
+        case MRAA_MUX_OP_OUT:
+            // Once the pin is known to be an output only the level is left
+            if (mraa_gpio_shadow_get(step->pin, MRAA_GPIO_SHADOW_DIR) == MRAA_GPIO_OUT) {
+                return mraa_gpio_write(dev, step->value);
+            }
+            return mraa_gpio_dir(dev, out);
+        case MRAA_MUX_OP_OUT_LEGACY:
+            if (mraa_gpio_shadow_get(step->pin, MRAA_GPIO_SHADOW_DIR) == MRAA_GPIO_OUT) {
+                return mraa_gpio_write(dev, step->value);
+            }
+            // the direction sometimes fails, this is not critical as long
+            // as the write succeeds - Test case galileo gen2 pin2
+            if (mraa_gpio_dir(dev, out) == MRAA_SUCCESS) {
+                return MRAA_SUCCESS;
+            }
+            return mraa_gpio_write(dev, step->value);
+        case MRAA_MUX_OP_IN_VALUE:
+            ret = mraa_gpio_dir(dev, MRAA_GPIO_IN);
+            if (ret == MRAA_SUCCESS) {
+                ret = mraa_gpio_write(dev, step->value);
+            }
+            return ret;
+        case MRAA_MUX_OP_MODE:
+            return mraa_gpio_mode(dev, step->value);
+    }
+
+    return MRAA_ERROR_FEATURE_NOT_IMPLEMENTED;
+}
+
+mraa_result_t
+mraa_gpio_mux_plan_run(mraa_gpio_mux_plan_t plan)
+{
+    mraa_result_t ret = MRAA_SUCCESS;
+
+    pthread_mutex_lock(&mux.lock);
+    for (unsigned int i = 0; i < plan->num_steps; ++i) {
+        const struct _gpio_mux_step* step = &plan->steps[i];
+        mraa_gpio_context dev = mraa_gpio_mux_handle(step->pin);
+        if (dev == NULL) {
+            ret = MRAA_ERROR_INVALID_HANDLE;
+            break;
+        }
+
+        ret = mraa_gpio_mux_step_run(dev, step);
+        if (ret == MRAA_SUCCESS) {
+            continue;
+        }
+
+        // The pin may have been unexported under the pooled context, retry on a fresh one
+        mraa_gpio_mux_handle_drop(step->pin);
+        dev = mraa_gpio_mux_handle(step->pin);
+        if (dev == NULL || mraa_gpio_mux_step_run(dev, step) != MRAA_SUCCESS) {
+            mraa_gpio_mux_handle_drop(step->pin);
+            ret = MRAA_ERROR_INVALID_RESOURCE;
+            break;
+        }
+        ret = MRAA_SUCCESS;
+    }
+    pthread_mutex_unlock(&mux.lock);
+
+    return ret;
+}
+
+void
+mraa_gpio_mux_cleanup()
+{
+    pthread_mutex_lock(&mux.lock);
+    while (mux.handles != NULL) {
+        mraa_gpio_mux_handle_drop(mux.handles->pin);
+    }
+
+    while (mux.plans != NULL) {
+        struct _gpio_mux_plan* plan = mux.plans;
+        mux.plans = plan->next;
+        free(plan);
+    }
+    pthread_mutex_unlock(&mux.lock);
+}
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "gpio/gpio_recorder.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+mraa_gpio_recorder_t
+mraa_gpio_recorder_new(const char* path, size_t size, const int pins[], unsigned int num_pins, uint64_t levels, mraa_timestamp_t start)
+{
+    long page = sysconf(_SC_PAGESIZE);
+    size_t data_offset = (sizeof(mraa_gpio_record_header) + page - 1) / page * page;
+
+    mraa_gpio_recorder_t recorder = calloc(1, sizeof(struct _gpio_recorder));
+    if (recorder == NULL) {
+        syslog(LOG_CRIT, "gpio: Failed to allocate memory for recorder");
+        return NULL;
+    }
+
+    recorder->fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (recorder->fd < 0) {
+        syslog(LOG_ERR, "gpio: record: failed to create %s: %s", path, strerror(errno));
+        free(recorder);
+        return NULL;
+    }
+
+    recorder->map_size = data_offset + size;
+    if (ftruncate(recorder->fd, recorder->map_size) != 0) {
+        syslog(LOG_ERR, "gpio: record: failed to size %s: %s", path, strerror(errno));
+        close(recorder->fd);
+        free(recorder);
+        return NULL;
+    }
+
+    void* map = mmap(NULL, recorder->map_size, PROT_READ | PROT_WRITE, MAP_SHARED, recorder->fd, 0);
+    if (map == MAP_FAILED) {
+        syslog(LOG_ERR, "gpio: record: failed to map %s: %s", path, strerror(errno));
+        close(recorder->fd);
+        free(recorder);
+        return NULL;
+    }
+
+    recorder->header = (mraa_gpio_record_header*) map;
+    recorder->data = (uint8_t*) map + data_offset;
+    recorder->last_timestamp = start;
+
+    mraa_gpio_record_header* header = recorder->header;
+    memcpy(header->magic, MRAA_GPIO_RECORD_MAGIC, sizeof(header->magic));
+    header->version = 1;
+    header->data_offset = data_offset;
+    header->capacity = size;
+    header->tail_timestamp = start;
+    header->tail_levels = levels;
+    header->num_pins = num_pins;
+    for (unsigned int i = 0; i < num_pins; ++i) {
+        header->pins[i] = pins[i];
+    }
+
+    return recorder;
+}
+
+/*
+ * The low 7 bits of a record are the pin and the level, so the first byte
+ * holds them and the zigzag delta follows as a varint of its own. This is
+ * the LEB128 of the whole record without shifting the delta out of 64 bits.
+ */
+unsigned int
+mraa_gpio_recorder_encode(int64_t delta, int idx, int level, uint8_t* record)
+{
+    uint64_t zigzag = ((uint64_t) delta << 1) ^ (uint64_t) (delta >> 63);
+    unsigned int len = 1;
+
+    record[0] = ((idx & 0x3f) << 1) | (level ? 1 : 0);
+    while (zigzag != 0) {
+        record[len - 1] |= 0x80;
+        record[len++] = zigzag & 0x7f;
+        zigzag >>= 7;
+    }
+
+    return len;
+}
+
+/* Decode the record at pos of a ring, returns its length or 0 if it is malformed. */
+unsigned int
+mraa_gpio_recorder_decode(const uint8_t* data, uint64_t capacity, uint64_t pos, int64_t* delta, int* idx, int* level)
+{
+    uint8_t byte = data[pos % capacity];
+    uint64_t zigzag = 0;
+    unsigned int len = 1;
+    int shift = 0;
+
+    *idx = (byte >> 1) & 0x3f;
+    *level = byte & 1;
+    while (byte & 0x80) {
+        if (len == MRAA_GPIO_RECORD_MAX_LEN) {
+            return 0;
+        }
+        byte = data[(pos + len++) % capacity];
+        zigzag |= (uint64_t) (byte & 0x7f) << shift;
+        shift += 7;
+    }
+    *delta = (int64_t) (zigzag >> 1) ^ -(int64_t) (zigzag & 1);
+
+    return len;
+}
+
+/* Forget the oldest record to make room, folding it into the tail state. */
+static void
+mraa_gpio_recorder_drop_oldest(mraa_gpio_recorder_t recorder)
+{
+    mraa_gpio_record_header* header = recorder->header;
+    int64_t delta;
+    int idx, level;
+
+    header->tail += mraa_gpio_recorder_decode(recorder->data, header->capacity, header->tail, &delta, &idx, &level);
+    header->tail_timestamp += delta;
+    if (level) {
+        header->tail_levels |= 1ULL << idx;
+    } else {
+        header->tail_levels &= ~(1ULL << idx);
+    }
+    header->overwritten++;
+}
+
+void
+mraa_gpio_recorder_edge(mraa_gpio_recorder_t recorder, int idx, int level, mraa_timestamp_t timestamp)
+{
+    mraa_gpio_record_header* header = recorder->header;
+    uint8_t record[MRAA_GPIO_RECORD_MAX_LEN];
+
+    // Chips are read one after the other, time may step back a little between them
+    unsigned int len = mraa_gpio_recorder_encode((int64_t) (timestamp - recorder->last_timestamp), idx, level, record);
+
+    while (header->head + len - header->tail > header->capacity) {
+        mraa_gpio_recorder_drop_oldest(recorder);
+    }
+
+    for (unsigned int i = 0; i < len; ++i) {
+        recorder->data[(header->head + i) % header->capacity] = record[i];
+    }
+
+    header->head += len;
+    header->events++;
+    recorder->last_timestamp = timestamp;
+}
+
+void
+mraa_gpio_recorder_add_dropped(mraa_gpio_recorder_t recorder, unsigned int count)
+{
+    recorder->header->dropped += count;
+}
+
+mraa_result_t
+mraa_gpio_recorder_close(mraa_gpio_recorder_t recorder, mraa_gpio_record_header* header)
+{
+    mraa_result_t ret = MRAA_SUCCESS;
+
+    if (recorder == NULL) {
+        return MRAA_SUCCESS;
+    }
+
+    if (header != NULL) {
+        *header = *recorder->header;
+    }
+
+    if (msync(recorder->header, recorder->map_size, MS_SYNC) != 0) {
+        syslog(LOG_ERR, "gpio: record: failed to flush recording: %s", strerror(errno));
+        ret = MRAA_ERROR_UNSPECIFIED;
+    }
+
+    munmap(recorder->header, recorder->map_size);
+    close(recorder->fd);
+    free(recorder);
+
+    return ret;
+}
+
+mraa_result_t
+mraa_gpio_recorder_write_vcd(const char* path, FILE* out)
+{
+    mraa_gpio_record_header header;
+    uint8_t* data;
+    FILE* fp = fopen(path, "rb");
+    if (fp == NULL) {
+        syslog(LOG_ERR, "gpio: record: failed to open %s: %s", path, strerror(errno));
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+
+    if (fread(&header, sizeof(header), 1, fp) != 1 ||
+        memcmp(header.magic, MRAA_GPIO_RECORD_MAGIC, sizeof(header.magic)) != 0 || header.version != 1 ||
+        header.num_pins > 64 || header.capacity == 0 || header.head - header.tail > header.capacity) {
+        syslog(LOG_ERR, "gpio: record: %s is not a recording", path);
+        fclose(fp);
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+
+    data = malloc(header.capacity);
+    if (data == NULL) {
+        syslog(LOG_CRIT, "gpio: record: Failed to allocate memory for %s", path);
+        fclose(fp);
+        return MRAA_ERROR_NO_RESOURCES;
+    }
+    if (fseek(fp, header.data_offset, SEEK_SET) != 0 || fread(data, 1, header.capacity, fp) != header.capacity) {
+        syslog(LOG_ERR, "gpio: record: %s is truncated", path);
+        free(data);
+        fclose(fp);
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+    fclose(fp);
+
+    // one printable identifier per pin, from '!'
+    fprintf(out, "$timescale 1ns $end\n$scope module mraa $end\n");
+    for (unsigned int i = 0; i < header.num_pins; ++i) {
+        fprintf(out, "$var wire 1 %c pin%d $end\n", '!' + i, header.pins[i]);
+    }
+    fprintf(out, "$upscope $end\n$enddefinitions $end\n#0\n$dumpvars\n");
+    for (unsigned int i = 0; i < header.num_pins; ++i) {
+        fprintf(out, "%d%c\n", (int) ((header.tail_levels >> i) & 1), '!' + i);
+    }
+    fprintf(out, "$end\n");
+
+    int64_t timestamp = 0, last = 0;
+    for (uint64_t pos = header.tail; pos < header.head;) {
+        int64_t delta;
+        int idx, level;
+        unsigned int len = mraa_gpio_recorder_decode(data, header.capacity, pos, &delta, &idx, &level);
+
+        if (len == 0 || (unsigned int) idx >= header.num_pins) {
+            syslog(LOG_ERR, "gpio: record: malformed record at %llu in %s", (unsigned long long) pos, path);
+            free(data);
+            return MRAA_ERROR_INVALID_RESOURCE;
+        }
+        pos += len;
+        timestamp += delta;
+
+        // VCD time only moves forward, edges of different chips may not
+        if (timestamp > last) {
+            last = timestamp;
+            fprintf(out, "#%lld\n", (long long) last);
+        }
+        fprintf(out, "%d%c\n", level, '!' + idx);
+    }
+
+    free(data);
+    return MRAA_SUCCESS;
+}
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "gpio/gpio_registry.h"
+#include "gpio/gpio_chardev.h"
+#include "gpio/gpio_shadow.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define SYSFS_CLASS_GPIO "/sys/class/gpio"
+#define MAX_SIZE 64
+
+static struct {
+    pthread_mutex_t lock;
+    struct _gpio_pin_ref* pins;
+    struct _gpio_pin_ref* chips;
+} registry = { PTHREAD_MUTEX_INITIALIZER, NULL, NULL };
+
+static struct _gpio_pin_ref*
+mraa_gpio_registry_find(struct _gpio_pin_ref* list, int pin)
+{
+    for (; list != NULL; list = list->next) {
+        if (list->pin == pin) {
+            return list;
+        }
+    }
+
+    return NULL;
+}
+
+static void
+mraa_gpio_registry_unlink(struct _gpio_pin_ref** list, struct _gpio_pin_ref* ref)
+{
+    for (; *list != NULL; list = &(*list)->next) {
+        if (*list == ref) {
+            *list = ref->next;
+            return;
+        }
+    }
+}
+
+static mraa_result_t
+mraa_gpio_registry_write(const char* file, int pin)
+{
+    char bu[MAX_SIZE];
+    int length = snprintf(bu, sizeof(bu), "%d", pin);
+
+    int fd = open(file, O_WRONLY);
+    if (fd == -1) {
+        syslog(LOG_ERR, "gpio%i: Failed to open '%s' for writing: %s", pin, file, strerror(errno));
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+
+    if (write(fd, bu, length * sizeof(char)) == -1) {
+        syslog(LOG_ERR, "gpio%i: Failed to write to '%s': %s", pin, file, strerror(errno));
+        close(fd);
+        return MRAA_ERROR_UNSPECIFIED;
+    }
+
+    close(fd);
+
+    return MRAA_SUCCESS;
+}
+
+/* The value file is usable once udev applied its rules to the new node. */
+static mraa_boolean_t
+mraa_gpio_registry_ready(int pin)
+{
+    char path[MAX_SIZE];
+    snprintf(path, MAX_SIZE, SYSFS_CLASS_GPIO "/gpio%d/value", pin);
+
+    return access(path, R_OK | W_OK) == 0;
+}
+
+/*
+ * Wait until the value file of every pin is usable, or the timeout. The
+ * chmod / chown of udev raise IN_ATTRIB on the gpioN directory; the poll
+ * still wakes every few ms in case a node changed before its watch was set.
+ */
+static void
+mraa_gpio_registry_wait_ready(const int pins[], unsigned int num, int timeout_ms)
+{
+    uint64_t deadline = (mraa_monotonic_ns() / 1000000) + timeout_ms;
+    unsigned int pending = 0;
+    int ifd = inotify_init1(IN_CLOEXEC | IN_NONBLOCK);
+
+    for (unsigned int i = 0; i < num; ++i) {
+        if (pins[i] < 0 || mraa_gpio_registry_ready(pins[i])) {
+            continue;
+        }
+        if (ifd >= 0) {
+            char directory[MAX_SIZE];
+            snprintf(directory, MAX_SIZE, SYSFS_CLASS_GPIO "/gpio%d", pins[i]);
+            inotify_add_watch(ifd, directory, IN_ATTRIB | IN_CREATE);
+        }
+        pending++;
+    }
+
+    while (pending > 0) {
+        uint64_t now = (mraa_monotonic_ns() / 1000000);
+        if (now >= deadline) {
+            syslog(LOG_WARNING, "gpio: export: %u pins still not accessible after %d ms", pending, timeout_ms);
+            break;
+        }
+
+        if (ifd >= 0) {
+            char events[1024];
+            struct pollfd pfd = { .fd = ifd, .events = POLLIN };
+            int wait_ms = deadline - now < 10 ? (int) (deadline - now) : 10;
+
+            if (poll(&pfd, 1, wait_ms) > 0) {
+                while (read(ifd, events, sizeof(events)) > 0)
+                    ;
+            }
+        } else {
+            usleep(1000);
+        }
+
+        pending = 0;
+        for (unsigned int i = 0; i < num; ++i) {
+            if (pins[i] >= 0 && !mraa_gpio_registry_ready(pins[i])) {
+                pending++;
+            }
+        }
+    }
+
+    if (ifd >= 0) {
+        close(ifd);
+    }
+}
+
+/* Find or create the entry of pin, registry lock held. Sets *fresh when this
+ * call exported the pin, the caller then waits for it. */
+static struct _gpio_pin_ref*
+mraa_gpio_registry_get(int pin, mraa_boolean_t* fresh)
+{
+    struct _gpio_pin_ref* ref;
+
+    *fresh = 0;
+
+    ref = mraa_gpio_registry_find(registry.pins, pin);
+    if (ref != NULL) {
+        ref->refcount++;
+        return ref;
+    }
+
+    ref = calloc(1, sizeof(struct _gpio_pin_ref));
+    if (ref == NULL) {
+        syslog(LOG_CRIT, "gpio%i: Failed to allocate memory for pin registry", pin);
+        return NULL;
+    }
+
+    // then check to make sure the pin is exported.
+    char directory[MAX_SIZE];
+    struct stat dir;
+    snprintf(directory, MAX_SIZE, SYSFS_CLASS_GPIO "/gpio%d/", pin);
+    if (stat(directory, &dir) != 0 || !S_ISDIR(dir.st_mode)) {
+        if (mraa_gpio_registry_write(SYSFS_CLASS_GPIO "/export", pin) != MRAA_SUCCESS) {
+            free(ref);
+            return NULL;
+        }
+        ref->exported = 1;
+        *fresh = 1;
+        // a fresh export starts from the kernel defaults, not what we last wrote
+        mraa_gpio_shadow_invalidate(pin);
+    }
+
+    ref->pin = pin;
+    ref->refcount = 1;
+    ref->fd = -1;
+    ref->next = registry.pins;
+    registry.pins = ref;
+
+    return ref;
+}
+
+struct _gpio_pin_ref*
+mraa_gpio_registry_acquire(int pin, mraa_boolean_t* exported)
+{
+    struct _gpio_pin_ref* ref;
+    mraa_boolean_t fresh;
+
+    *exported = 0;
+
+    pthread_mutex_lock(&registry.lock);
+    ref = mraa_gpio_registry_get(pin, &fresh);
+    if (ref != NULL && ref->exported && !ref->claimed) {
+        ref->claimed = 1;
+        *exported = 1;
+    }
+    pthread_mutex_unlock(&registry.lock);
+
+    if (fresh) {
+        mraa_gpio_registry_wait_ready(&pin, 1, MRAA_GPIO_EXPORT_TIMEOUT_MS);
+    }
+
+    return ref;
+}
+
+mraa_result_t
+mraa_gpio_registry_acquire_many(const int pins[], unsigned int num, struct _gpio_pin_ref* refs[])
+{
+    mraa_result_t ret = MRAA_SUCCESS;
+    int fresh_pins[num];
+
+    pthread_mutex_lock(&registry.lock);
+    for (unsigned int i = 0; i < num; ++i) {
+        mraa_boolean_t fresh;
+
+        refs[i] = mraa_gpio_registry_get(pins[i], &fresh);
+        if (refs[i] == NULL) {
+            ret = MRAA_ERROR_INVALID_RESOURCE;
+        }
+        fresh_pins[i] = fresh ? pins[i] : -1;
+    }
+    pthread_mutex_unlock(&registry.lock);
+
+    mraa_gpio_registry_wait_ready(fresh_pins, num, MRAA_GPIO_EXPORT_TIMEOUT_MS);
+
+    return ret;
+}
+
+void
+mraa_gpio_registry_release(struct _gpio_pin_ref* ref, mraa_boolean_t unexport)
+{
+    if (ref == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&registry.lock);
+    ref->unexport |= unexport;
+    if (--ref->refcount > 0) {
+        pthread_mutex_unlock(&registry.lock);
+        return;
+    }
+
+    // an export nobody claimed is undone too
+    if (ref->exported && !ref->claimed) {
+        ref->unexport = 1;
+    }
+
+    mraa_gpio_registry_unlink(&registry.pins, ref);
+    if (ref->unexport && mraa_gpio_registry_write(SYSFS_CLASS_GPIO "/unexport", ref->pin) == MRAA_SUCCESS) {
+        mraa_gpio_shadow_invalidate(ref->pin);
+    }
+    pthread_mutex_unlock(&registry.lock);
+
+    free(ref);
+}
+
+int
+mraa_gpio_registry_chip_acquire(unsigned int chip)
+{
+    struct _gpio_pin_ref* ref;
+    int fd;
+
+    pthread_mutex_lock(&registry.lock);
+    ref = mraa_gpio_registry_find(registry.chips, chip);
+    if (ref != NULL) {
+        ref->refcount++;
+        fd = ref->fd;
+        pthread_mutex_unlock(&registry.lock);
+        return fd;
+    }
+
+    ref = calloc(1, sizeof(struct _gpio_pin_ref));
+    if (ref == NULL) {
+        syslog(LOG_CRIT, "[GPIOD_INTERFACE]: Failed to allocate memory for chip registry");
+        pthread_mutex_unlock(&registry.lock);
+        return -1;
+    }
+
+    mraa_gpiod_chip_info* cinfo = mraa_get_chip_info_by_number(chip);
+    if (cinfo == NULL) {
+        syslog(LOG_ERR, "[GPIOD_INTERFACE]: error getting gpio_chip_info for chip %u", chip);
+        free(ref);
+        pthread_mutex_unlock(&registry.lock);
+        return -1;
+    }
+
+    ref->pin = chip;
+    ref->refcount = 1;
+    ref->fd = cinfo->chip_fd;
+    ref->next = registry.chips;
+    registry.chips = ref;
+    fd = ref->fd;
+    pthread_mutex_unlock(&registry.lock);
+
+    free(cinfo);
+
+    return fd;
+}
+
+void
+mraa_gpio_registry_chip_release(unsigned int chip)
+{
+    struct _gpio_pin_ref* ref;
+
+    pthread_mutex_lock(&registry.lock);
+    ref = mraa_gpio_registry_find(registry.chips, chip);
+    if (ref == NULL || --ref->refcount > 0) {
+        pthread_mutex_unlock(&registry.lock);
+        return;
+    }
+
+    mraa_gpio_registry_unlink(&registry.chips, ref);
+    pthread_mutex_unlock(&registry.lock);
+
+    close(ref->fd);
+    free(ref);
+}
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "gpio.h"
+#include "gpio/gpio_mmap.h"
+#include "mraa_internal.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct _gpio_sequence {
+    mraa_gpio_context dev;
+    mraa_gpio_seq_step* steps;
+    unsigned int num_steps;
+    struct _gpio_mmap_port* port; /**< NULL when steps go through mraa_gpio_write_mask() */
+    unsigned int generation;      /**< mmap_generation of the context port belongs to */
+    uint32_t* set_bits;           /**< num_steps rows of one word per bank */
+    uint32_t* clear_bits;
+};
+
+struct _gpio_sequence_job {
+    mraa_gpio_sequence seq;
+    struct _gpio_mmap_port* port; /**< compiled port if still current, else NULL */
+    unsigned int repeat;
+    int priority;
+    mraa_gpio_seq_stats stats;
+    mraa_result_t result;
+};
+
+static unsigned int
+mraa_gpio_sequence_num_pins(mraa_gpio_context dev)
+{
+    return dev->num_pins > 0 ? dev->num_pins : 1;
+}
+
+/* Resolve the register stores of every step once, indexed [step * num_banks + bank]. */
+static mraa_result_t
+mraa_gpio_sequence_compile_mmap(mraa_gpio_sequence seq)
+{
+    struct _gpio_mmap_port* port = seq->dev->mmap_port;
+
+    seq->set_bits = calloc((size_t) seq->num_steps * port->num_banks, sizeof(uint32_t));
+    seq->clear_bits = calloc((size_t) seq->num_steps * port->num_banks, sizeof(uint32_t));
+    if (seq->set_bits == NULL || seq->clear_bits == NULL) {
+        return MRAA_ERROR_NO_RESOURCES;
+    }
+
+    for (unsigned int i = 0; i < seq->num_steps; ++i) {
+        uint32_t* set_row = &seq->set_bits[i * port->num_banks];
+        uint32_t* clear_row = &seq->clear_bits[i * port->num_banks];
+
+        for (unsigned int p = 0; p < port->num_pins && p < 64; ++p) {
+            if (!(seq->steps[i].mask & (1ULL << p))) {
+                continue;
+            }
+            if (seq->steps[i].values & (1ULL << p)) {
+                set_row[port->pin_bank[p]] |= port->pin_mask[p];
+            } else {
+                clear_row[port->pin_bank[p]] |= port->pin_mask[p];
+            }
+        }
+    }
+
+    seq->port = port;
+    seq->generation = seq->dev->mmap_generation;
+
+    return MRAA_SUCCESS;
+}
+
+mraa_gpio_sequence
+mraa_gpio_sequence_new(mraa_gpio_context dev, const mraa_gpio_seq_step steps[], unsigned int num_steps)
+{
+    mraa_gpio_sequence seq;
+
+    if (dev == NULL) {
+        syslog(LOG_ERR, "gpio: sequence_new: context is invalid");
+        return NULL;
+    }
+
+    if (steps == NULL || num_steps == 0) {
+        syslog(LOG_ERR, "gpio%i: sequence_new: no steps given", dev->pin);
+        return NULL;
+    }
+
+    unsigned int num_pins = mraa_gpio_sequence_num_pins(dev);
+    uint64_t valid = num_pins >= 64 ? ~0ULL : (1ULL << num_pins) - 1;
+    for (unsigned int i = 0; i < num_steps; ++i) {
+        if (steps[i].mask & ~valid) {
+            syslog(LOG_ERR, "gpio%i: sequence_new: step %u drives pins beyond the %u of the context",
+                   dev->pin, i, num_pins);
+            return NULL;
+        }
+    }
+
+    seq = calloc(1, sizeof(struct _gpio_sequence));
+    if (seq == NULL) {
+        syslog(LOG_CRIT, "gpio%i: sequence_new: Failed to allocate memory for sequence", dev->pin);
+        return NULL;
+    }
+
+    seq->dev = dev;
+    seq->num_steps = num_steps;
+    seq->steps = malloc(num_steps * sizeof(mraa_gpio_seq_step));
+    if (seq->steps == NULL) {
+        syslog(LOG_CRIT, "gpio%i: sequence_new: Failed to allocate memory for sequence", dev->pin);
+        mraa_gpio_sequence_free(seq);
+        return NULL;
+    }
+    memcpy(seq->steps, steps, num_steps * sizeof(mraa_gpio_seq_step));
+
+    if (dev->mmap_port != NULL && mraa_gpio_sequence_compile_mmap(seq) != MRAA_SUCCESS) {
+        syslog(LOG_CRIT, "gpio%i: sequence_new: Failed to allocate memory for sequence", dev->pin);
+        mraa_gpio_sequence_free(seq);
+        return NULL;
+    }
+
+    return seq;
+}
+
+void
+mraa_gpio_sequence_free(mraa_gpio_sequence seq)
+{
+    if (seq == NULL) {
+        return;
+    }
+
+    free(seq->steps);
+    free(seq->set_bits);
+    free(seq->clear_bits);
+    free(seq);
+}
+
+static void*
+mraa_gpio_sequence_thread(void* arg)
+{
+    struct _gpio_sequence_job* job = (struct _gpio_sequence_job*) arg;
+    mraa_gpio_sequence seq = job->seq;
+    struct _gpio_mmap_port* port = job->port;
+    unsigned long long late_sum = 0;
+    uint64_t start, deadline, now;
+
+    if (job->priority > 0 && mraa_set_scheduler(SCHED_FIFO, job->priority) != 0) {
+        syslog(LOG_WARNING, "gpio: sequence: failed to set SCHED_FIFO priority %d: %s",
+               job->priority, strerror(errno));
+    }
+
+    start = deadline = mraa_monotonic_ns();
+
+    for (unsigned int r = 0; r < job->repeat; ++r) {
+        for (unsigned int i = 0; i < seq->num_steps; ++i) {
+            while ((now = mraa_monotonic_ns()) < deadline)
+                ;
+
+            if (port != NULL) {
+                mraa_gpio_mmap_apply(port, &seq->set_bits[i * port->num_banks],
+                                     &seq->clear_bits[i * port->num_banks]);
+            } else {
+                job->result = mraa_gpio_write_mask(seq->dev, seq->steps[i].values, seq->steps[i].mask);
+                if (job->result != MRAA_SUCCESS) {
+                    return NULL;
+                }
+            }
+
+            uint64_t late = now - deadline;
+            late_sum += late;
+            if (late > job->stats.late_max_ns) {
+                job->stats.late_max_ns = late;
+            }
+            job->stats.steps++;
+
+            // Absolute deadlines, a late step does not delay the next ones
+            deadline += seq->steps[i].delay_ns;
+            if (mraa_monotonic_ns() > deadline) {
+                job->stats.overruns++;
+            }
+        }
+    }
+
+    // Hold the last level for its delay too, so runs can be chained
+    while (mraa_monotonic_ns() < deadline)
+        ;
+
+    job->stats.duration_ns = deadline - start;
+    job->stats.late_mean_ns = late_sum / job->stats.steps;
+    job->result = MRAA_SUCCESS;
+
+    return NULL;
+}
+
+mraa_result_t
+mraa_gpio_sequence_run(mraa_gpio_sequence seq, unsigned int repeat, int priority, mraa_gpio_seq_stats* stats)
+{
+    struct _gpio_sequence_job job;
+    pthread_t thread;
+
+    if (seq == NULL) {
+        syslog(LOG_ERR, "gpio: sequence_run: sequence is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (repeat == 0) {
+        syslog(LOG_ERR, "gpio%i: sequence_run: repeat must be at least 1", seq->dev->pin);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    memset(&job, 0, sizeof(job));
+    job.seq = seq;
+    // The compiled stores point into the port, once mmap was toggled they
+    // may point into freed memory and the steps go through write_mask
+    if (seq->port != NULL && seq->generation == seq->dev->mmap_generation) {
+        job.port = seq->port;
+    }
+    job.repeat = repeat;
+    job.priority = priority;
+    job.result = MRAA_ERROR_UNSPECIFIED;
+
+    if (pthread_create(&thread, NULL, mraa_gpio_sequence_thread, &job) != 0) {
+        syslog(LOG_ERR, "gpio%i: sequence_run: failed to start the sequencer thread", seq->dev->pin);
+        return MRAA_ERROR_NO_RESOURCES;
+    }
+    pthread_join(thread, NULL);
+
+    if (stats != NULL) {
+        *stats = job.stats;
+    }
+
+    return job.result;
+}
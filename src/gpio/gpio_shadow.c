@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "gpio/gpio_shadow.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+/* Pins are added in blocks, sysfs numbers are dense on most boards. */
+#define MRAA_GPIO_SHADOW_BLOCK 64
+
+static struct {
+    pthread_mutex_t lock;
+    signed char (*pins)[MRAA_GPIO_SHADOW_ATTRS]; /**< indexed by raw pin */
+    unsigned int num_pins;
+} shadow = { PTHREAD_MUTEX_INITIALIZER, NULL, 0 };
+
+int
+mraa_gpio_shadow_get(int pin, mraa_gpio_shadow_attr_t attr)
+{
+    int value = MRAA_GPIO_SHADOW_UNKNOWN;
+
+    pthread_mutex_lock(&shadow.lock);
+    if (pin >= 0 && (unsigned int) pin < shadow.num_pins) {
+        value = shadow.pins[pin][attr];
+    }
+    pthread_mutex_unlock(&shadow.lock);
+
+    return value;
+}
+
+void
+mraa_gpio_shadow_set(int pin, mraa_gpio_shadow_attr_t attr, int value)
+{
+    if (pin < 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&shadow.lock);
+    if ((unsigned int) pin >= shadow.num_pins) {
+        unsigned int num_pins = (pin / MRAA_GPIO_SHADOW_BLOCK + 1) * MRAA_GPIO_SHADOW_BLOCK;
+        void* pins = realloc(shadow.pins, num_pins * sizeof(*shadow.pins));
+
+        // Without room the pin just stays unknown
+        if (pins == NULL) {
+            pthread_mutex_unlock(&shadow.lock);
+            return;
+        }
+
+        shadow.pins = pins;
+        for (unsigned int i = shadow.num_pins; i < num_pins; ++i) {
+            for (int a = 0; a < MRAA_GPIO_SHADOW_ATTRS; ++a) {
+                shadow.pins[i][a] = MRAA_GPIO_SHADOW_UNKNOWN;
+            }
+        }
+        shadow.num_pins = num_pins;
+    }
+    shadow.pins[pin][attr] = value;
+    pthread_mutex_unlock(&shadow.lock);
+}
+
+void
+mraa_gpio_shadow_invalidate(int pin)
+{
+    pthread_mutex_lock(&shadow.lock);
+    if (pin >= 0 && (unsigned int) pin < shadow.num_pins) {
+        for (int a = 0; a < MRAA_GPIO_SHADOW_ATTRS; ++a) {
+            shadow.pins[pin][a] = MRAA_GPIO_SHADOW_UNKNOWN;
+        }
+    }
+    pthread_mutex_unlock(&shadow.lock);
+}
+
+void
+mraa_gpio_shadow_free()
+{
+    pthread_mutex_lock(&shadow.lock);
+    free(shadow.pins);
+    shadow.pins = NULL;
+    shadow.num_pins = 0;
+    pthread_mutex_unlock(&shadow.lock);
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "gpio/gpio_snapshot.h"
+#include "gpio/gpio_chardev.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+int
+mraa_gpio_snapshot_read_group(struct _gpio_group* group, uint64_t* bits, mraa_timestamp_t* timestamp)
+{
+    mraa_timestamp_t before = mraa_monotonic_ns();
+    int status = mraa_get_line_bits(group->gpiod_handle, MRAA_GPIOD_LINES_MASK(group->num_gpio_lines), bits);
+    mraa_timestamp_t after = mraa_monotonic_ns();
+
+    // The lines were sampled somewhere inside the ioctl
+    *timestamp = before + (after - before) / 2;
+
+    return status;
+}
+
+static void*
+mraa_gpio_snapshot_worker_thread(void* arg)
+{
+    struct _gpio_snapshot_worker* worker = (struct _gpio_snapshot_worker*) arg;
+    struct _gpio_snapshot_pool* pool = worker->pool;
+    unsigned long seen = 0;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->generation == seen && !pool->stop) {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if (pool->stop) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        worker->status = mraa_gpio_snapshot_read_group(worker->group, &worker->bits, &worker->timestamp);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) {
+            pthread_cond_signal(&pool->done);
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+static struct _gpio_snapshot_pool*
+mraa_gpio_snapshot_pool_new(mraa_gpio_context dev, unsigned int num_workers)
+{
+    mraa_gpiod_group_t gpio_iter;
+    unsigned int idx = 0;
+    struct _gpio_snapshot_pool* pool =
+    calloc(1, sizeof(struct _gpio_snapshot_pool) + num_workers * sizeof(struct _gpio_snapshot_worker));
+    if (pool == NULL) {
+        syslog(LOG_CRIT, "gpio: snapshot: Failed to allocate memory for reader threads");
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    for_each_gpio_group(gpio_iter, dev)
+    {
+        // the first chip is read by the caller
+        if (idx > 0) {
+            struct _gpio_snapshot_worker* worker = &pool->workers[idx - 1];
+
+            worker->pool = pool;
+            worker->group = gpio_iter;
+            if (pthread_create(&worker->thread, NULL, mraa_gpio_snapshot_worker_thread, worker) != 0) {
+                syslog(LOG_ERR, "gpio: snapshot: failed to start a reader thread");
+                mraa_gpio_snapshot_pool_free(pool);
+                return NULL;
+            }
+            pool->num_workers++;
+        }
+        idx++;
+    }
+
+    return pool;
+}
+
+void
+mraa_gpio_snapshot_pool_free(struct _gpio_snapshot_pool* pool)
+{
+    if (pool == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (unsigned int i = 0; i < pool->num_workers; ++i) {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+}
+
+/* Scatter the group bits to the pin order given at init. */
+static void
+mraa_gpio_snapshot_scatter(struct _gpio_group* group, uint64_t bits, mraa_timestamp_t timestamp, uint64_t* values, mraa_timestamp_t timestamps[])
+{
+    for (unsigned int j = 0; j < group->num_gpio_lines; ++j) {
+        int pin_idx = group->gpio_group_to_pins_table[j];
+
+        if ((bits >> j) & 1ULL) {
+            *values |= 1ULL << pin_idx;
+        }
+        if (timestamps != NULL) {
+            timestamps[pin_idx] = timestamp;
+        }
+    }
+}
+
+mraa_result_t
+mraa_gpio_snapshot_chardev(mraa_gpio_context dev, uint64_t* values, mraa_timestamp_t timestamps[], mraa_boolean_t parallel)
+{
+    mraa_gpiod_group_t gpio_iter;
+    unsigned int num_groups = 0;
+    uint64_t bits;
+    mraa_timestamp_t timestamp;
+
+    *values = 0;
+
+    for_each_gpio_group(gpio_iter, dev)
+    {
+        num_groups++;
+    }
+
+    if (!parallel || num_groups < 2) {
+        for_each_gpio_group(gpio_iter, dev)
+        {
+            if (mraa_gpio_snapshot_read_group(gpio_iter, &bits, &timestamp) < 0) {
+                syslog(LOG_ERR, "[GPIOD_INTERFACE]: snapshot: error reading gpio chip %u", gpio_iter->gpio_chip);
+                return MRAA_ERROR_INVALID_RESOURCE;
+            }
+            mraa_gpio_snapshot_scatter(gpio_iter, bits, timestamp, values, timestamps);
+        }
+
+        return MRAA_SUCCESS;
+    }
+
+    if (dev->snapshot_pool == NULL) {
+        dev->snapshot_pool = mraa_gpio_snapshot_pool_new(dev, num_groups - 1);
+        if (dev->snapshot_pool == NULL) {
+            return MRAA_ERROR_NO_RESOURCES;
+        }
+    }
+
+    struct _gpio_snapshot_pool* pool = dev->snapshot_pool;
+    struct _gpio_group* first = NULL;
+    int status;
+
+    for_each_gpio_group(gpio_iter, dev)
+    {
+        first = gpio_iter;
+        break;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->pending = pool->num_workers;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    status = mraa_gpio_snapshot_read_group(first, &bits, &timestamp);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0) {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    if (status < 0) {
+        syslog(LOG_ERR, "[GPIOD_INTERFACE]: snapshot: error reading gpio chip %u", first->gpio_chip);
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+    mraa_gpio_snapshot_scatter(first, bits, timestamp, values, timestamps);
+
+    for (unsigned int i = 0; i < pool->num_workers; ++i) {
+        struct _gpio_snapshot_worker* worker = &pool->workers[i];
+
+        if (worker->status < 0) {
+            syslog(LOG_ERR, "[GPIOD_INTERFACE]: snapshot: error reading gpio chip %u", worker->group->gpio_chip);
+            return MRAA_ERROR_INVALID_RESOURCE;
+        }
+        mraa_gpio_snapshot_scatter(worker->group, worker->bits, worker->timestamp, values, timestamps);
+    }
+
+    return MRAA_SUCCESS;
+}
@@ -9,6 +9,8 @@
  */
 
 #include "i2c.h"
+#include "i2c/i2c_bus.h"
+#include "i2c/i2c_queue.h"
 #include "mraa_internal.h"
 
 #include <stdlib.h>
@@ -25,6 +27,9 @@
 #include <errno.h>
 #include <string.h>
 
+/* Longest message i2c-dev accepts in an I2C_RDWR ioctl. */
+#define MRAA_I2C_MSG_MAX 8192
+
 typedef union i2c_smbus_data_union {
     uint8_t byte;        ///< data byte
     unsigned short word; ///< data short word
@@ -55,6 +60,42 @@ mraa_i2c_smbus_access(int fh, uint8_t read_write, uint8_t command, int size, i2c
     return ioctl(fh, I2C_SMBUS, &args);
 }
 
+/* SMBus transfers go to the slave selected on the shared descriptor, select
+ * the one of the context first and keep other contexts off the bus meanwhile. */
+static int
+mraa_i2c_smbus_selected(mraa_i2c_context dev, uint8_t read_write, uint8_t command, int size, i2c_smbus_data_t* data)
+{
+    int ret = -1;
+
+    pthread_mutex_lock(&dev->bus->lock);
+    if (mraa_i2c_bus_select(dev->bus, dev->addr) == MRAA_SUCCESS) {
+        ret = mraa_i2c_smbus_access(dev->fh, read_write, command, size, data);
+    }
+    pthread_mutex_unlock(&dev->bus->lock);
+
+    return ret;
+}
+
+static mraa_result_t
+mraa_i2c_rdwr(mraa_i2c_context dev, struct i2c_msg* msgs, int num_msgs, const char* caller)
+{
+    struct i2c_rdwr_ioctl_data d;
+
+    d.msgs = msgs;
+    d.nmsgs = num_msgs;
+
+    // No slave to select, the lock only keeps out of mraa_i2c_begin() scopes
+    pthread_mutex_lock(&dev->bus->lock);
+    int ret = ioctl(dev->fh, I2C_RDWR, &d);
+    pthread_mutex_unlock(&dev->bus->lock);
+
+    if (ret < 0) {
+        syslog(LOG_ERR, "i2c%i: %s: Access error: %s", dev->busnum, caller, strerror(errno));
+        return MRAA_ERROR_UNSPECIFIED;
+    }
+    return MRAA_SUCCESS;
+}
+
 static mraa_i2c_context
 mraa_i2c_init_internal(mraa_adv_func_t* advance_func, unsigned int bus)
 {
@@ -83,18 +124,13 @@ mraa_i2c_init_internal(mraa_adv_func_t* advance_func, unsigned int bus)
         if (status != MRAA_SUCCESS)
             goto init_internal_cleanup;
     } else {
-        char filepath[32];
-        snprintf(filepath, 32, "/dev/i2c-%u", bus);
-        if ((dev->fh = open(filepath, O_RDWR)) < 1) {
-            syslog(LOG_ERR, "i2c%i_init: Failed to open requested i2c port %s: %s", bus, filepath, strerror(errno));
+        dev->bus = mraa_i2c_bus_acquire(bus);
+        if (dev->bus == NULL) {
             status = MRAA_ERROR_INVALID_RESOURCE;
             goto init_internal_cleanup;
         }
-
-        if (ioctl(dev->fh, I2C_FUNCS, &dev->funcs) < 0) {
-            syslog(LOG_CRIT, "i2c%i_init: Failed to get I2C_FUNC map from device: %s", bus, strerror(errno));
-            dev->funcs = 0;
-        }
+        dev->fh = dev->bus->fh;
+        dev->funcs = dev->bus->funcs;
     }
 
     if (IS_FUNC_DEFINED(dev, i2c_init_post)) {
@@ -108,8 +144,10 @@ init_internal_cleanup:
     if (status == MRAA_SUCCESS) {
         return dev;
     } else {
-        if (dev != NULL)
+        if (dev != NULL) {
+            mraa_i2c_bus_release(dev->bus);
             free(dev);
+        }
         return NULL;
    }
 }
@@ -204,7 +242,11 @@ mraa_i2c_read(mraa_i2c_context dev, uint8_t* data, int length)
         bytes_read = dev->advance_func->i2c_read_replace(dev, data, length);
     }
     else {
-        bytes_read = read(dev->fh, data, length);
+        pthread_mutex_lock(&dev->bus->lock);
+        if (mraa_i2c_bus_select(dev->bus, dev->addr) == MRAA_SUCCESS) {
+            bytes_read = read(dev->fh, data, length);
+        }
+        pthread_mutex_unlock(&dev->bus->lock);
     }
     if (bytes_read == length) {
         return length;
@@ -224,7 +266,7 @@ mraa_i2c_read_byte(mraa_i2c_context dev)
     if (IS_FUNC_DEFINED(dev, i2c_read_byte_replace))
         return dev->advance_func->i2c_read_byte_replace(dev);
     i2c_smbus_data_t d;
-    if (mraa_i2c_smbus_access(dev->fh, I2C_SMBUS_READ, I2C_NOCMD, I2C_SMBUS_BYTE, &d) < 0) {
+    if (mraa_i2c_smbus_selected(dev, I2C_SMBUS_READ, I2C_NOCMD, I2C_SMBUS_BYTE, &d) < 0) {
         syslog(LOG_ERR, "i2c%i: read_byte: Access error: %s", dev->busnum, strerror(errno));
         return -1;
     }
@@ -242,7 +284,7 @@ mraa_i2c_read_byte_data(mraa_i2c_context dev, uint8_t command)
     if (IS_FUNC_DEFINED(dev, i2c_read_byte_data_replace))
         return dev->advance_func->i2c_read_byte_data_replace(dev, command);
     i2c_smbus_data_t d;
-    if (mraa_i2c_smbus_access(dev->fh, I2C_SMBUS_READ, command, I2C_SMBUS_BYTE_DATA, &d) < 0) {
+    if (mraa_i2c_smbus_selected(dev, I2C_SMBUS_READ, command, I2C_SMBUS_BYTE_DATA, &d) < 0) {
        syslog(LOG_ERR, "i2c%i: read_byte_data: Access error: %s", dev->busnum, strerror(errno));
        return -1;
     }
@@ -260,7 +302,7 @@ mraa_i2c_read_word_data(mraa_i2c_context dev, uint8_t command)
     if (IS_FUNC_DEFINED(dev, i2c_read_word_data_replace))
         return dev->advance_func->i2c_read_word_data_replace(dev, command);
     i2c_smbus_data_t d;
-    if (mraa_i2c_smbus_access(dev->fh, I2C_SMBUS_READ, command, I2C_SMBUS_WORD_DATA, &d) < 0) {
+    if (mraa_i2c_smbus_selected(dev, I2C_SMBUS_READ, command, I2C_SMBUS_WORD_DATA, &d) < 0) {
         syslog(LOG_ERR, "i2c%i: read_word_data: Access error: %s", dev->busnum, strerror(errno));
         return -1;
     }
@@ -277,7 +319,6 @@ mraa_i2c_read_bytes_data(mraa_i2c_context dev, uint8_t command, uint8_t* data, i
 
     if (IS_FUNC_DEFINED(dev, i2c_read_bytes_data_replace))
         return dev->advance_func->i2c_read_bytes_data_replace(dev, command, data, length);
-    struct i2c_rdwr_ioctl_data d;
     struct i2c_msg m[2];
 
     m[0].addr = dev->addr;
@@ -289,19 +330,60 @@ mraa_i2c_read_bytes_data(mraa_i2c_context dev, uint8_t command, uint8_t* data, i
     m[1].len = length;
     m[1].buf = (char*) data;
 
-    d.msgs = m;
-    d.nmsgs = 2;
-
-    int ret = ioctl(dev->fh, I2C_RDWR, &d);
-
-    if (ret < 0)
-    {
-        syslog(LOG_ERR, "i2c%i: read_bytes_data: Access error: %s", dev->busnum, strerror(errno));
+    if (mraa_i2c_rdwr(dev, m, 2, "read_bytes_data") != MRAA_SUCCESS) {
         return -1;
     }
     return length;
 }
 
+/* SMBus block writes carry at most 32 bytes after the command. */
+static mraa_result_t
+mraa_i2c_write_smbus(mraa_i2c_context dev, const uint8_t* data, int length)
+{
+    i2c_smbus_data_t d;
+
+    if (length - 1 > I2C_SMBUS_I2C_BLOCK_MAX) {
+        syslog(LOG_ERR, "i2c%i: write: SMBus adapter takes %d bytes after the command, not %d", dev->busnum,
+               I2C_SMBUS_I2C_BLOCK_MAX, length - 1);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    d.block[0] = length - 1;
+    memcpy(&d.block[1], &data[1], length - 1);
+
+    if (mraa_i2c_smbus_selected(dev, I2C_SMBUS_WRITE, data[0], I2C_SMBUS_I2C_BLOCK_DATA, &d) < 0) {
+        syslog(LOG_ERR, "i2c%i: write: Access error: %s", dev->busnum, strerror(errno));
+        return MRAA_ERROR_UNSPECIFIED;
+    }
+
+    return MRAA_SUCCESS;
+}
+
+/* SMBus block reads return at most 32 bytes, longer ranges take several. */
+mraa_result_t
+mraa_i2c_read_smbus(mraa_i2c_context dev, uint8_t command, uint8_t* data, int length)
+{
+    i2c_smbus_data_t d;
+
+    if (command + length > 256) {
+        syslog(LOG_ERR, "i2c%i: read: SMBus commands end at 0xFF, not 0x%X", dev->busnum, command + length - 1);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    for (int off = 0; off < length; off += I2C_SMBUS_I2C_BLOCK_MAX) {
+        int len = length - off < I2C_SMBUS_I2C_BLOCK_MAX ? length - off : I2C_SMBUS_I2C_BLOCK_MAX;
+
+        d.block[0] = len;
+        if (mraa_i2c_smbus_selected(dev, I2C_SMBUS_READ, command + off, I2C_SMBUS_I2C_BLOCK_DATA, &d) < 0) {
+            syslog(LOG_ERR, "i2c%i: read: Access error: %s", dev->busnum, strerror(errno));
+            return MRAA_ERROR_UNSPECIFIED;
+        }
+        memcpy(&data[off], &d.block[1], len);
+    }
+
+    return MRAA_SUCCESS;
+}
+
 mraa_result_t
 mraa_i2c_write(mraa_i2c_context dev, const uint8_t* data, int length)
 {
@@ -312,25 +394,43 @@ mraa_i2c_write(mraa_i2c_context dev, const uint8_t* data, int length)
 
     if (IS_FUNC_DEFINED(dev, i2c_write_replace))
         return dev->advance_func->i2c_write_replace(dev, data, length);
-    i2c_smbus_data_t d;
-    int i;
-    uint8_t command = data[0];
 
-    data = &data[1];
-    length = length - 1;
-    if (length > I2C_SMBUS_I2C_BLOCK_MAX) {
-        length = I2C_SMBUS_I2C_BLOCK_MAX;
+    if (data == NULL || length < 1) {
+        syslog(LOG_ERR, "i2c%i: write: Nothing to write", dev->busnum);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    // funcs is 0 when the adapter could not be queried, assume plain i2c then
+    if (dev->funcs != 0 && !(dev->funcs & I2C_FUNC_I2C)) {
+        return mraa_i2c_write_smbus(dev, data, length);
     }
 
-    for (i = 1; i <= length; i++) {
-        d.block[i] = data[i - 1];
+    // Never split: each part would start at the command again and devices
+    // auto-incrementing their register would store the data in the wrong place
+    int write_max = dev->write_max != 0 ? dev->write_max : MRAA_I2C_MSG_MAX;
+    if (length > write_max) {
+        syslog(LOG_ERR, "i2c%i: write: Adapter takes at most %d bytes in one message, not %d", dev->busnum,
+               write_max, length);
+        return MRAA_ERROR_INVALID_PARAMETER;
     }
-    d.block[0] = length;
 
-    if (mraa_i2c_smbus_access(dev->fh, I2C_SMBUS_WRITE, command, I2C_SMBUS_I2C_BLOCK_DATA, &d) < 0) {
+    struct i2c_msg m = { .addr = dev->addr, .flags = 0x00, .len = length, .buf = (char*) data };
+    struct i2c_rdwr_ioctl_data d = { .msgs = &m, .nmsgs = 1 };
+
+    pthread_mutex_lock(&dev->bus->lock);
+    int ret = ioctl(dev->fh, I2C_RDWR, &d);
+    pthread_mutex_unlock(&dev->bus->lock);
+    if (ret < 0) {
+        // Adapters with a shorter limit refuse the message, later writes this long fail early
+        if ((errno == EOPNOTSUPP || errno == EINVAL) && length > I2C_SMBUS_I2C_BLOCK_MAX + 1) {
+            dev->write_max = length - 1;
+            syslog(LOG_ERR, "i2c%i: write: Adapter refused %d bytes in one message", dev->busnum, length);
+            return MRAA_ERROR_INVALID_PARAMETER;
+        }
         syslog(LOG_ERR, "i2c%i: write: Access error: %s", dev->busnum, strerror(errno));
         return MRAA_ERROR_UNSPECIFIED;
     }
+
     return MRAA_SUCCESS;
 }
 
@@ -345,7 +445,7 @@ mraa_i2c_write_byte(mraa_i2c_context dev, const uint8_t data)
     if (IS_FUNC_DEFINED(dev, i2c_write_byte_replace)) {
         return dev->advance_func->i2c_write_byte_replace(dev, data);
     } else {
-        if (mraa_i2c_smbus_access(dev->fh, I2C_SMBUS_WRITE, data, I2C_SMBUS_BYTE, NULL) < 0) {
+        if (mraa_i2c_smbus_selected(dev, I2C_SMBUS_WRITE, data, I2C_SMBUS_BYTE, NULL) < 0) {
             syslog(LOG_ERR, "i2c%i: write_byte: Access error: %s", dev->busnum, strerror(errno));
             return MRAA_ERROR_UNSPECIFIED;
         }
@@ -365,7 +465,7 @@ mraa_i2c_write_byte_data(mraa_i2c_context dev, const uint8_t data, const uint8_t
         return dev->advance_func->i2c_write_byte_data_replace(dev, data, command);
     i2c_smbus_data_t d;
     d.byte = data;
-    if (mraa_i2c_smbus_access(dev->fh, I2C_SMBUS_WRITE, command, I2C_SMBUS_BYTE_DATA, &d) < 0) {
+    if (mraa_i2c_smbus_selected(dev, I2C_SMBUS_WRITE, command, I2C_SMBUS_BYTE_DATA, &d) < 0) {
         syslog(LOG_ERR, "i2c%i: write_byte_data: Access error: %s", dev->busnum, strerror(errno));
         return MRAA_ERROR_UNSPECIFIED;
     }
@@ -384,13 +484,215 @@ mraa_i2c_write_word_data(mraa_i2c_context dev, const uint16_t data, const uint8_
         return dev->advance_func->i2c_write_word_data_replace(dev, data, command);
     i2c_smbus_data_t d;
     d.word = data;
-    if (mraa_i2c_smbus_access(dev->fh, I2C_SMBUS_WRITE, command, I2C_SMBUS_WORD_DATA, &d) < 0) {
+    if (mraa_i2c_smbus_selected(dev, I2C_SMBUS_WRITE, command, I2C_SMBUS_WORD_DATA, &d) < 0) {
         syslog(LOG_ERR, "i2c%i: write_word_data: Access error: %s", dev->busnum, strerror(errno));
         return MRAA_ERROR_UNSPECIFIED;
     }
     return MRAA_SUCCESS;
 }
 
+mraa_result_t
+mraa_i2c_transfer(mraa_i2c_context dev, mraa_i2c_msg msgs[], unsigned int num_msgs)
+{
+    if (dev == NULL) {
+        syslog(LOG_ERR, "i2c: transfer: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (msgs == NULL || num_msgs == 0 || num_msgs > I2C_RDRW_IOCTL_MAX_MSGS) {
+        syslog(LOG_ERR, "i2c%i: transfer: %u messages, expected 1 to %d", dev->busnum, num_msgs,
+               I2C_RDRW_IOCTL_MAX_MSGS);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    if (IS_FUNC_DEFINED(dev, i2c_transfer_replace))
+        return dev->advance_func->i2c_transfer_replace(dev, msgs, num_msgs);
+
+    // Replaced buses have no /dev/i2c-* to send the messages to
+    if (IS_FUNC_DEFINED(dev, i2c_init_bus_replace)) {
+        syslog(LOG_ERR, "i2c%i: transfer: Not supported by this bus", dev->busnum);
+        return MRAA_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+
+    // funcs is 0 when the adapter could not be queried, let the kernel decide then
+    if (dev->funcs != 0 && !(dev->funcs & I2C_FUNC_I2C)) {
+        syslog(LOG_ERR, "i2c%i: transfer: Adapter only supports SMBus", dev->busnum);
+        return MRAA_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+
+    struct i2c_msg m[I2C_RDRW_IOCTL_MAX_MSGS];
+
+    for (unsigned int i = 0; i < num_msgs; ++i) {
+        if (msgs[i].flags & ~(MRAA_I2C_MSG_READ | MRAA_I2C_MSG_NOSTART)) {
+            syslog(LOG_ERR, "i2c%i: transfer: Unknown flags 0x%X in message %u", dev->busnum, msgs[i].flags, i);
+            return MRAA_ERROR_INVALID_PARAMETER;
+        }
+        if ((msgs[i].flags & MRAA_I2C_MSG_NOSTART) && dev->funcs != 0 && !(dev->funcs & I2C_FUNC_NOSTART)) {
+            syslog(LOG_ERR, "i2c%i: transfer: Adapter cannot skip the repeated start", dev->busnum);
+            return MRAA_ERROR_FEATURE_NOT_SUPPORTED;
+        }
+        if (msgs[i].len > 0 && msgs[i].buf == NULL) {
+            syslog(LOG_ERR, "i2c%i: transfer: Message %u has no buffer", dev->busnum, i);
+            return MRAA_ERROR_INVALID_PARAMETER;
+        }
+
+        m[i].addr = msgs[i].addr;
+        m[i].flags = (msgs[i].flags & MRAA_I2C_MSG_READ ? I2C_M_RD : 0) |
+                     (msgs[i].flags & MRAA_I2C_MSG_NOSTART ? I2C_M_NOSTART : 0);
+        m[i].len = msgs[i].len;
+        m[i].buf = (char*) msgs[i].buf;
+    }
+
+    return mraa_i2c_rdwr(dev, m, num_msgs, "transfer");
+}
+
+int
+mraa_i2c_read_bytes_reg16(mraa_i2c_context dev, uint16_t reg, uint8_t* data, int length)
+{
+    if (dev == NULL) {
+        syslog(LOG_ERR, "i2c: read_bytes_reg16: context is invalid");
+        return -1;
+    }
+
+    if (data == NULL || length <= 0 || length > MRAA_I2C_MSG_MAX) {
+        syslog(LOG_ERR, "i2c%i: read_bytes_reg16: Invalid length %d", dev->busnum, length);
+        return -1;
+    }
+
+    uint8_t addr[2] = { reg >> 8, reg & 0xFF };
+    mraa_i2c_msg m[2] = {
+        { .addr = dev->addr, .flags = 0, .len = 2, .buf = addr },
+        { .addr = dev->addr, .flags = MRAA_I2C_MSG_READ, .len = length, .buf = data },
+    };
+
+    if (mraa_i2c_transfer(dev, m, 2) != MRAA_SUCCESS) {
+        return -1;
+    }
+    return length;
+}
+
+mraa_result_t
+mraa_i2c_write_bytes_reg16(mraa_i2c_context dev, uint16_t reg, const uint8_t* data, int length)
+{
+    if (dev == NULL) {
+        syslog(LOG_ERR, "i2c: write_bytes_reg16: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (data == NULL || length <= 0 || length > MRAA_I2C_MSG_MAX - 2) {
+        syslog(LOG_ERR, "i2c%i: write_bytes_reg16: Invalid length %d", dev->busnum, length);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    uint8_t buf[length + 2];
+    buf[0] = reg >> 8;
+    buf[1] = reg & 0xFF;
+    memcpy(&buf[2], data, length);
+
+    mraa_i2c_msg m = { .addr = dev->addr, .flags = 0, .len = length + 2, .buf = buf };
+    return mraa_i2c_transfer(dev, &m, 1);
+}
+
+int
+mraa_i2c_read_words_data(mraa_i2c_context dev, uint8_t command, uint16_t* words, int count, mraa_i2c_endian_t endian)
+{
+    if (dev == NULL) {
+        syslog(LOG_ERR, "i2c: read_words_data: context is invalid");
+        return -1;
+    }
+
+    if (words == NULL || count <= 0 || count > MRAA_I2C_MSG_MAX / 2) {
+        syslog(LOG_ERR, "i2c%i: read_words_data: Invalid count %d", dev->busnum, count);
+        return -1;
+    }
+
+    // Read into the destination itself, then convert in place
+    uint8_t* bytes = (uint8_t*) words;
+    mraa_i2c_msg m[2] = {
+        { .addr = dev->addr, .flags = 0, .len = 1, .buf = &command },
+        { .addr = dev->addr, .flags = MRAA_I2C_MSG_READ, .len = count * 2, .buf = bytes },
+    };
+
+    if (mraa_i2c_transfer(dev, m, 2) != MRAA_SUCCESS) {
+        return -1;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        uint8_t first = bytes[2 * i], second = bytes[2 * i + 1];
+        words[i] = endian == MRAA_I2C_BIG_ENDIAN ? (first << 8) | second : (second << 8) | first;
+    }
+    return count;
+}
+
+mraa_result_t
+mraa_i2c_write_words_data(mraa_i2c_context dev, uint8_t command, const uint16_t* words, int count, mraa_i2c_endian_t endian)
+{
+    if (dev == NULL) {
+        syslog(LOG_ERR, "i2c: write_words_data: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (words == NULL || count <= 0 || count > (MRAA_I2C_MSG_MAX - 1) / 2) {
+        syslog(LOG_ERR, "i2c%i: write_words_data: Invalid count %d", dev->busnum, count);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    uint8_t buf[1 + 2 * count];
+    buf[0] = command;
+    for (int i = 0; i < count; ++i) {
+        uint8_t high = words[i] >> 8, low = words[i] & 0xFF;
+        buf[1 + 2 * i] = endian == MRAA_I2C_BIG_ENDIAN ? high : low;
+        buf[2 + 2 * i] = endian == MRAA_I2C_BIG_ENDIAN ? low : high;
+    }
+
+    mraa_i2c_msg m = { .addr = dev->addr, .flags = 0, .len = 1 + 2 * count, .buf = buf };
+    return mraa_i2c_transfer(dev, &m, 1);
+}
+
+mraa_result_t
+mraa_i2c_read_reg_blocks(mraa_i2c_context dev, mraa_i2c_reg_block blocks[], unsigned int num_blocks, mraa_boolean_t reg16)
+{
+    if (dev == NULL) {
+        syslog(LOG_ERR, "i2c: read_reg_blocks: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (blocks == NULL || num_blocks == 0 || num_blocks > I2C_RDRW_IOCTL_MAX_MSGS / 2) {
+        syslog(LOG_ERR, "i2c%i: read_reg_blocks: %u blocks, expected 1 to %d", dev->busnum, num_blocks,
+               I2C_RDRW_IOCTL_MAX_MSGS / 2);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    // A register write and a read per block, all in one transaction
+    mraa_i2c_msg m[2 * num_blocks];
+    uint8_t regs[num_blocks][2];
+
+    for (unsigned int i = 0; i < num_blocks; ++i) {
+        if (!reg16 && blocks[i].reg > 0xFF) {
+            syslog(LOG_ERR, "i2c%i: read_reg_blocks: Register 0x%X needs 16-bit addressing", dev->busnum,
+                   blocks[i].reg);
+            return MRAA_ERROR_INVALID_PARAMETER;
+        }
+        if (reg16) {
+            regs[i][0] = blocks[i].reg >> 8;
+            regs[i][1] = blocks[i].reg & 0xFF;
+        } else {
+            regs[i][0] = blocks[i].reg & 0xFF;
+        }
+
+        m[2 * i].addr = dev->addr;
+        m[2 * i].flags = 0;
+        m[2 * i].len = reg16 ? 2 : 1;
+        m[2 * i].buf = regs[i];
+        m[2 * i + 1].addr = dev->addr;
+        m[2 * i + 1].flags = MRAA_I2C_MSG_READ;
+        m[2 * i + 1].len = blocks[i].len;
+        m[2 * i + 1].buf = blocks[i].buf;
+    }
+
+    return mraa_i2c_transfer(dev, m, 2 * num_blocks);
+}
+
 mraa_result_t
 mraa_i2c_address(mraa_i2c_context dev, uint8_t addr)
 {
@@ -403,14 +705,97 @@ mraa_i2c_address(mraa_i2c_context dev, uint8_t addr)
     if (IS_FUNC_DEFINED(dev, i2c_address_replace)) {
         return dev->advance_func->i2c_address_replace(dev, addr);
     } else {
-        if (ioctl(dev->fh, I2C_SLAVE_FORCE, addr) < 0) {
-            syslog(LOG_ERR, "i2c%i: address: Failed to set slave address %d: %s", dev->busnum, addr, strerror(errno));
-            return MRAA_ERROR_UNSPECIFIED;
+        // Selecting now reports a bad address here, the bus skips it if selected
+        pthread_mutex_lock(&dev->bus->lock);
+        mraa_result_t ret = mraa_i2c_bus_select(dev->bus, dev->addr);
+        pthread_mutex_unlock(&dev->bus->lock);
+        return ret;
+    }
+}
+
+
+mraa_result_t
+mraa_i2c_submit(mraa_i2c_context dev, mraa_i2c_job* job, mraa_i2c_job_cb cb)
+{
+    if (dev == NULL) {
+        syslog(LOG_ERR, "i2c: submit: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (job == NULL || job->msgs == NULL || job->num_msgs == 0 || job->num_msgs > I2C_RDRW_IOCTL_MAX_MSGS) {
+        syslog(LOG_ERR, "i2c%i: submit: Invalid job", dev->busnum);
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    if (dev->queue == NULL) {
+        dev->queue = mraa_i2c_queue_acquire(dev->busnum);
+        if (dev->queue == NULL) {
+            return MRAA_ERROR_NO_RESOURCES;
         }
-        return MRAA_SUCCESS;
     }
+
+    return mraa_i2c_queue_push(dev->queue, dev, job, cb);
+}
+
+unsigned int
+mraa_i2c_queue_depth(mraa_i2c_context dev)
+{
+    if (dev == NULL || dev->queue == NULL) {
+        return 0;
+    }
+
+    return mraa_i2c_queue_count(dev->queue);
+}
+
+mraa_result_t
+mraa_i2c_wait_jobs(mraa_i2c_context dev)
+{
+    if (dev == NULL) {
+        syslog(LOG_ERR, "i2c: wait_jobs: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (dev->queue != NULL) {
+        return mraa_i2c_queue_wait(dev->queue, dev);
+    }
+    return MRAA_SUCCESS;
+}
+
+mraa_result_t
+mraa_i2c_begin(mraa_i2c_context dev)
+{
+    if (dev == NULL) {
+        syslog(LOG_ERR, "i2c: begin: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (dev->bus == NULL) {
+        syslog(LOG_ERR, "i2c%i: begin: Not supported by this bus", dev->busnum);
+        return MRAA_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+
+    pthread_mutex_lock(&dev->bus->lock);
+    return MRAA_SUCCESS;
 }
 
+mraa_result_t
+mraa_i2c_end(mraa_i2c_context dev)
+{
+    if (dev == NULL) {
+        syslog(LOG_ERR, "i2c: end: context is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (dev->bus == NULL) {
+        return MRAA_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+
+    if (pthread_mutex_unlock(&dev->bus->lock) != 0) {
+        syslog(LOG_ERR, "i2c%i: end: No transaction open in this thread", dev->busnum);
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+    return MRAA_SUCCESS;
+}
 
 mraa_result_t
 mraa_i2c_stop(mraa_i2c_context dev)
@@ -420,11 +805,26 @@ mraa_i2c_stop(mraa_i2c_context dev)
         return MRAA_ERROR_INVALID_HANDLE;
     }
 
+    // Jobs still queued point at the context
+    if (dev->queue != NULL) {
+        // The worker can neither wait for its own jobs nor join itself
+        if (pthread_equal(pthread_self(), dev->queue->thread)) {
+            syslog(LOG_ERR, "i2c%i: stop: Called from a job callback", dev->busnum);
+            return MRAA_ERROR_INVALID_RESOURCE;
+        }
+        mraa_result_t ret = mraa_i2c_queue_wait(dev->queue, dev);
+        if (ret != MRAA_SUCCESS) {
+            return ret;
+        }
+        mraa_i2c_queue_release(dev->queue);
+        dev->queue = NULL;
+    }
+
     if (IS_FUNC_DEFINED(dev, i2c_stop_replace)) {
         return dev->advance_func->i2c_stop_replace(dev);
     }
 
-    close(dev->fh);
+    mraa_i2c_bus_release(dev->bus);
     free(dev);
     return MRAA_SUCCESS;
 }
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "i2c/i2c_bus.h"
+#include "linux/i2c-dev.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+static struct {
+    pthread_mutex_t lock;
+    struct _i2c_bus* buses;
+} registry = { PTHREAD_MUTEX_INITIALIZER, NULL };
+
+struct _i2c_bus*
+mraa_i2c_bus_acquire(unsigned int busnum)
+{
+    struct _i2c_bus* bus;
+    char filepath[32];
+
+    pthread_mutex_lock(&registry.lock);
+    for (bus = registry.buses; bus != NULL; bus = bus->next) {
+        if (bus->busnum == busnum) {
+            bus->refcount++;
+            pthread_mutex_unlock(&registry.lock);
+            return bus;
+        }
+    }
+
+    bus = calloc(1, sizeof(struct _i2c_bus));
+    if (bus == NULL) {
+        syslog(LOG_CRIT, "i2c%i_init: Failed to allocate memory for bus", busnum);
+        pthread_mutex_unlock(&registry.lock);
+        return NULL;
+    }
+
+    snprintf(filepath, 32, "/dev/i2c-%u", busnum);
+    if ((bus->fh = open(filepath, O_RDWR)) < 1) {
+        syslog(LOG_ERR, "i2c%i_init: Failed to open requested i2c port %s: %s", busnum, filepath, strerror(errno));
+        free(bus);
+        pthread_mutex_unlock(&registry.lock);
+        return NULL;
+    }
+
+    if (ioctl(bus->fh, I2C_FUNCS, &bus->funcs) < 0) {
+        syslog(LOG_CRIT, "i2c%i_init: Failed to get I2C_FUNC map from device: %s", busnum, strerror(errno));
+        bus->funcs = 0;
+    }
+
+    bus->busnum = busnum;
+    bus->refcount = 1;
+    bus->selected_addr = -1;
+
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&bus->lock, &attr);
+    pthread_mutexattr_destroy(&attr);
+    bus->next = registry.buses;
+    registry.buses = bus;
+    pthread_mutex_unlock(&registry.lock);
+
+    return bus;
+}
+
+void
+mraa_i2c_bus_release(struct _i2c_bus* bus)
+{
+    struct _i2c_bus** it;
+
+    if (bus == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&registry.lock);
+    if (--bus->refcount > 0) {
+        pthread_mutex_unlock(&registry.lock);
+        return;
+    }
+
+    for (it = &registry.buses; *it != NULL; it = &(*it)->next) {
+        if (*it == bus) {
+            *it = bus->next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&registry.lock);
+
+    close(bus->fh);
+    pthread_mutex_destroy(&bus->lock);
+    free(bus);
+}
+
+mraa_result_t
+mraa_i2c_bus_select(struct _i2c_bus* bus, int addr)
+{
+    if (bus->selected_addr == addr) {
+        return MRAA_SUCCESS;
+    }
+
+    if (ioctl(bus->fh, I2C_SLAVE_FORCE, addr) < 0) {
+        syslog(LOG_ERR, "i2c%i: address: Failed to set slave address %d: %s", bus->busnum, addr, strerror(errno));
+        bus->selected_addr = -1;
+        return MRAA_ERROR_UNSPECIFIED;
+    }
+    bus->selected_addr = addr;
+
+    return MRAA_SUCCESS;
+}
@@ -0,0 +1,411 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "i2c/i2c_bus.h"
+#include "i2c/i2c_poller.h"
+#include "linux/i2c-dev.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Longest block a merge may produce, i2c-dev refuses longer messages. */
+#define MRAA_I2C_POLL_BLOCK_MAX 8192
+
+/* Read one block on its own, used to isolate a failing device. */
+static mraa_result_t
+mraa_i2c_poller_read_block(struct _i2c_poll_bus* pbus, struct _i2c_poll_block* block, uint8_t* reg)
+{
+    if (!pbus->no_rdwr) {
+        mraa_i2c_msg m[2] = {
+            { .addr = block->addr, .flags = 0, .len = 1, .buf = reg },
+            { .addr = block->addr, .flags = MRAA_I2C_MSG_READ, .len = block->len, .buf = &pbus->scratch[block->scratch] },
+        };
+        mraa_result_t ret = mraa_i2c_transfer(pbus->dev, m, 2);
+        if (ret != MRAA_ERROR_FEATURE_NOT_SUPPORTED) {
+            return ret;
+        }
+        pbus->no_rdwr = 1;
+    }
+
+    // read_bytes_data() is I2C_RDWR as well, SMBus adapters only do block reads
+    if (mraa_i2c_address(pbus->dev, block->addr) != MRAA_SUCCESS) {
+        return MRAA_ERROR_UNSPECIFIED;
+    }
+    return mraa_i2c_read_smbus(pbus->dev, block->reg, &pbus->scratch[block->scratch], block->len);
+}
+
+static void
+mraa_i2c_poller_tick(struct _i2c_poll_bus* pbus, unsigned long tick)
+{
+    unsigned int num_blocks = 0;
+    size_t scratch = 0;
+
+    // Merge the due ranges, entries are sorted by address and register
+    for (unsigned int i = 0; i < pbus->num_entries; ++i) {
+        struct _i2c_poll_entry* entry = &pbus->entries[i];
+        const mraa_i2c_poll_desc* desc = &pbus->poller->descs[entry->desc];
+
+        entry->due = tick >= entry->next;
+        if (!entry->due) {
+            continue;
+        }
+        entry->next = tick + entry->every;
+
+        struct _i2c_poll_block* last = num_blocks > 0 ? &pbus->blocks[num_blocks - 1] : NULL;
+        if (last != NULL && last->addr == desc->addr && desc->reg <= last->reg + last->len &&
+            desc->reg + desc->len - last->reg <= MRAA_I2C_POLL_BLOCK_MAX) {
+            if (desc->reg + desc->len > last->reg + last->len) {
+                scratch += desc->reg + desc->len - (last->reg + last->len);
+                last->len = desc->reg + desc->len - last->reg;
+            }
+        } else {
+            last = &pbus->blocks[num_blocks++];
+            last->addr = desc->addr;
+            last->reg = desc->reg;
+            last->len = desc->len;
+            last->scratch = scratch;
+            scratch += desc->len;
+        }
+        entry->scratch = last->scratch + (desc->reg - last->reg);
+    }
+
+    if (num_blocks == 0) {
+        return;
+    }
+
+    // Up to 21 write / read pairs per I2C_RDWR, devices mixed
+    for (unsigned int first = 0; first < num_blocks; first += I2C_RDRW_IOCTL_MAX_MSGS / 2) {
+        unsigned int count = num_blocks - first < I2C_RDRW_IOCTL_MAX_MSGS / 2 ? num_blocks - first : I2C_RDRW_IOCTL_MAX_MSGS / 2;
+        mraa_result_t ret = MRAA_ERROR_FEATURE_NOT_SUPPORTED;
+
+        for (unsigned int b = first; b < first + count; ++b) {
+            struct _i2c_poll_block* block = &pbus->blocks[b];
+
+            pbus->block_regs[b] = block->reg;
+            pbus->msgs[2 * (b - first)] = (mraa_i2c_msg){ block->addr, 0, 1, &pbus->block_regs[b] };
+            pbus->msgs[2 * (b - first) + 1] =
+            (mraa_i2c_msg){ block->addr, MRAA_I2C_MSG_READ, block->len, &pbus->scratch[block->scratch] };
+        }
+
+        if (!pbus->no_rdwr) {
+            ret = mraa_i2c_transfer(pbus->dev, pbus->msgs, 2 * count);
+        }
+
+        for (unsigned int b = first; b < first + count; ++b) {
+            // One device not answering fails the whole call, find out which
+            pbus->blocks[b].status = ret == MRAA_SUCCESS ? MRAA_SUCCESS :
+                                                          mraa_i2c_poller_read_block(pbus, &pbus->blocks[b], &pbus->block_regs[b]);
+        }
+    }
+
+    mraa_timestamp_t now = mraa_monotonic_ns();
+    unsigned int back = !pbus->front;
+    struct _i2c_poll_snapshot* front_snap = &pbus->snapshots[pbus->front];
+    struct _i2c_poll_snapshot* snap = &pbus->snapshots[back];
+
+    __atomic_store_n(&snap->seq, snap->seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    // The back buffer is a tick old, bring it up to date before applying the new reads
+    memcpy(snap->data, front_snap->data, pbus->data_size);
+    memcpy(snap->timestamps, front_snap->timestamps, pbus->num_entries * sizeof(mraa_timestamp_t));
+    memcpy(snap->status, front_snap->status, pbus->num_entries * sizeof(mraa_result_t));
+
+    for (unsigned int i = 0, b = 0; i < pbus->num_entries; ++i) {
+        struct _i2c_poll_entry* entry = &pbus->entries[i];
+
+        if (!entry->due) {
+            continue;
+        }
+        while (b + 1 < num_blocks && pbus->blocks[b + 1].scratch <= entry->scratch) {
+            b++;
+        }
+
+        snap->status[i] = pbus->blocks[b].status;
+        if (snap->status[i] == MRAA_SUCCESS) {
+            memcpy(&snap->data[entry->offset], &pbus->scratch[entry->scratch], pbus->poller->descs[entry->desc].len);
+            snap->timestamps[i] = now;
+        }
+    }
+
+    __atomic_store_n(&snap->seq, snap->seq + 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&pbus->front, back, __ATOMIC_RELEASE);
+}
+
+static void*
+mraa_i2c_poller_thread(void* arg)
+{
+    struct _i2c_poll_bus* pbus = (struct _i2c_poll_bus*) arg;
+    struct _i2c_poller* poller = pbus->poller;
+    mraa_timestamp_t start = mraa_monotonic_ns();
+    unsigned long tick = 0;
+
+    pthread_mutex_lock(&poller->lock);
+    while (!poller->stop) {
+        pthread_mutex_unlock(&poller->lock);
+        mraa_i2c_poller_tick(pbus, tick);
+        pthread_mutex_lock(&poller->lock);
+
+        // A late tick is skipped rather than run in a burst, periods stay aligned
+        mraa_timestamp_t now = mraa_monotonic_ns();
+        tick = (now - start) / poller->tick_ns + 1;
+
+        mraa_timestamp_t deadline = start + tick * poller->tick_ns;
+        struct timespec ts = { .tv_sec = deadline / 1000000000ULL, .tv_nsec = deadline % 1000000000ULL };
+        while (!poller->stop && pthread_cond_timedwait(&poller->wake, &poller->lock, &ts) != ETIMEDOUT)
+            ;
+    }
+    pthread_mutex_unlock(&poller->lock);
+
+    return NULL;
+}
+
+static int
+mraa_i2c_poller_compare(const mraa_i2c_poll_desc* da, const mraa_i2c_poll_desc* db)
+{
+    if (da->addr != db->addr) {
+        return da->addr - db->addr;
+    }
+    return da->reg - db->reg;
+}
+
+static mraa_result_t
+mraa_i2c_poller_setup_bus(struct _i2c_poller* poller, struct _i2c_poll_bus* pbus)
+{
+    size_t scratch_size = 0;
+
+    pbus->poller = poller;
+    pbus->dev = mraa_i2c_init(pbus->bus);
+    if (pbus->dev == NULL) {
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+
+    pbus->entries = calloc(pbus->num_entries, sizeof(struct _i2c_poll_entry));
+    pbus->blocks = calloc(pbus->num_entries, sizeof(struct _i2c_poll_block));
+    pbus->block_regs = calloc(pbus->num_entries, sizeof(uint8_t));
+    pbus->msgs = calloc(I2C_RDRW_IOCTL_MAX_MSGS, sizeof(mraa_i2c_msg));
+    if (pbus->entries == NULL || pbus->blocks == NULL || pbus->block_regs == NULL || pbus->msgs == NULL) {
+        return MRAA_ERROR_NO_RESOURCES;
+    }
+
+    unsigned int n = 0;
+    for (unsigned int d = 0; d < poller->num_descs; ++d) {
+        if (poller->descs[d].bus != pbus->bus) {
+            continue;
+        }
+        const mraa_i2c_poll_desc* desc = &poller->descs[d];
+        uint64_t period_ns = (uint64_t) desc->period_ms * 1000000ULL;
+
+        pbus->entries[n].desc = d;
+        pbus->entries[n].every = period_ns <= poller->tick_ns ? 1 : (period_ns + poller->tick_ns - 1) / poller->tick_ns;
+        pbus->entries[n].offset = pbus->data_size;
+        pbus->data_size += desc->len;
+        scratch_size += desc->len;
+        n++;
+    }
+
+    // Insertion sort, stable so equal ranges keep the order they were given in
+    for (unsigned int i = 1; i < pbus->num_entries; ++i) {
+        struct _i2c_poll_entry entry = pbus->entries[i];
+        unsigned int j = i;
+
+        while (j > 0 && mraa_i2c_poller_compare(&poller->descs[pbus->entries[j - 1].desc], &poller->descs[entry.desc]) > 0) {
+            pbus->entries[j] = pbus->entries[j - 1];
+            j--;
+        }
+        pbus->entries[j] = entry;
+    }
+    for (unsigned int i = 0; i < pbus->num_entries; ++i) {
+        poller->desc_entry[pbus->entries[i].desc] = i;
+    }
+
+    pbus->scratch = calloc(scratch_size, sizeof(uint8_t));
+    if (pbus->scratch == NULL) {
+        return MRAA_ERROR_NO_RESOURCES;
+    }
+
+    for (int s = 0; s < 2; ++s) {
+        pbus->snapshots[s].data = calloc(pbus->data_size, sizeof(uint8_t));
+        pbus->snapshots[s].timestamps = calloc(pbus->num_entries, sizeof(mraa_timestamp_t));
+        pbus->snapshots[s].status = calloc(pbus->num_entries, sizeof(mraa_result_t));
+        if (pbus->snapshots[s].data == NULL || pbus->snapshots[s].timestamps == NULL || pbus->snapshots[s].status == NULL) {
+            return MRAA_ERROR_NO_RESOURCES;
+        }
+        for (unsigned int i = 0; i < pbus->num_entries; ++i) {
+            pbus->snapshots[s].status[i] = MRAA_ERROR_INVALID_RESOURCE;
+        }
+    }
+
+    return MRAA_SUCCESS;
+}
+
+mraa_i2c_poller
+mraa_i2c_poller_start(const mraa_i2c_poll_desc descs[], unsigned int num_descs, unsigned int tick_ms)
+{
+    mraa_i2c_poller poller;
+    pthread_condattr_t attr;
+
+    if (descs == NULL || num_descs == 0 || tick_ms == 0) {
+        syslog(LOG_ERR, "i2c: poller_start: no descriptors or no tick");
+        return NULL;
+    }
+
+    for (unsigned int d = 0; d < num_descs; ++d) {
+        if (descs[d].len == 0 || descs[d].reg + descs[d].len > 0x100) {
+            syslog(LOG_ERR, "i2c: poller_start: descriptor %u reads past register 0xFF", d);
+            return NULL;
+        }
+    }
+
+    poller = calloc(1, sizeof(struct _i2c_poller));
+    if (poller == NULL) {
+        syslog(LOG_CRIT, "i2c: poller_start: Failed to allocate memory for poller");
+        return NULL;
+    }
+
+    pthread_mutex_init(&poller->lock, NULL);
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&poller->wake, &attr);
+    pthread_condattr_destroy(&attr);
+
+    poller->tick_ns = (uint64_t) tick_ms * 1000000ULL;
+    poller->num_descs = num_descs;
+    poller->descs = malloc(num_descs * sizeof(mraa_i2c_poll_desc));
+    poller->desc_bus = calloc(num_descs, sizeof(unsigned int));
+    poller->desc_entry = calloc(num_descs, sizeof(unsigned int));
+    poller->buses = calloc(num_descs, sizeof(struct _i2c_poll_bus));
+    if (poller->descs == NULL || poller->desc_bus == NULL || poller->desc_entry == NULL || poller->buses == NULL) {
+        syslog(LOG_CRIT, "i2c: poller_start: Failed to allocate memory for poller");
+        mraa_i2c_poller_stop(poller);
+        return NULL;
+    }
+    memcpy(poller->descs, descs, num_descs * sizeof(mraa_i2c_poll_desc));
+
+    // One thread per bus, buses are read in parallel
+    for (unsigned int d = 0; d < num_descs; ++d) {
+        unsigned int b;
+
+        for (b = 0; b < poller->num_buses && poller->buses[b].bus != descs[d].bus; ++b)
+            ;
+        if (b == poller->num_buses) {
+            poller->buses[b].bus = descs[d].bus;
+            poller->num_buses++;
+        }
+        poller->buses[b].num_entries++;
+        poller->desc_bus[d] = b;
+    }
+
+    for (unsigned int b = 0; b < poller->num_buses; ++b) {
+        struct _i2c_poll_bus* pbus = &poller->buses[b];
+
+        if (mraa_i2c_poller_setup_bus(poller, pbus) != MRAA_SUCCESS) {
+            syslog(LOG_ERR, "i2c: poller_start: Failed to set up bus %d", pbus->bus);
+            mraa_i2c_poller_stop(poller);
+            return NULL;
+        }
+    }
+
+    for (unsigned int b = 0; b < poller->num_buses; ++b) {
+        struct _i2c_poll_bus* pbus = &poller->buses[b];
+
+        if (pthread_create(&pbus->thread, NULL, mraa_i2c_poller_thread, pbus) != 0) {
+            syslog(LOG_ERR, "i2c: poller_start: Failed to start the thread of bus %d", pbus->bus);
+            mraa_i2c_poller_stop(poller);
+            return NULL;
+        }
+        pbus->started = 1;
+    }
+
+    return poller;
+}
+
+mraa_result_t
+mraa_i2c_poller_read(mraa_i2c_poller poller, unsigned int idx, uint8_t* data, mraa_timestamp_t* timestamp)
+{
+    struct _i2c_poll_bus* pbus;
+    struct _i2c_poll_entry* entry;
+    struct _i2c_poll_snapshot* snap;
+    mraa_timestamp_t stamp;
+    mraa_result_t status;
+    unsigned int seq, entry_idx;
+
+    if (poller == NULL) {
+        syslog(LOG_ERR, "i2c: poller_read: poller is invalid");
+        return MRAA_ERROR_INVALID_HANDLE;
+    }
+
+    if (idx >= poller->num_descs || data == NULL) {
+        return MRAA_ERROR_INVALID_PARAMETER;
+    }
+
+    pbus = &poller->buses[poller->desc_bus[idx]];
+    entry_idx = poller->desc_entry[idx];
+    entry = &pbus->entries[entry_idx];
+
+    // Retry while the writer reuses the buffer being copied, it never waits on readers
+    do {
+        snap = &pbus->snapshots[__atomic_load_n(&pbus->front, __ATOMIC_ACQUIRE)];
+        seq = __atomic_load_n(&snap->seq, __ATOMIC_ACQUIRE);
+        if (seq & 1) {
+            continue;
+        }
+        memcpy(data, &snap->data[entry->offset], poller->descs[idx].len);
+        stamp = snap->timestamps[entry_idx];
+        status = snap->status[entry_idx];
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while ((seq & 1) || __atomic_load_n(&snap->seq, __ATOMIC_RELAXED) != seq);
+
+    if (timestamp != NULL) {
+        *timestamp = stamp;
+    }
+
+    return status;
+}
+
+void
+mraa_i2c_poller_stop(mraa_i2c_poller poller)
+{
+    if (poller == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&poller->lock);
+    poller->stop = 1;
+    pthread_cond_broadcast(&poller->wake);
+    pthread_mutex_unlock(&poller->lock);
+
+    for (unsigned int b = 0; poller->buses != NULL && b < poller->num_buses; ++b) {
+        struct _i2c_poll_bus* pbus = &poller->buses[b];
+
+        if (pbus->started) {
+            pthread_join(pbus->thread, NULL);
+        }
+        if (pbus->dev != NULL) {
+            mraa_i2c_stop(pbus->dev);
+        }
+        for (int s = 0; s < 2; ++s) {
+            free(pbus->snapshots[s].data);
+            free(pbus->snapshots[s].timestamps);
+            free(pbus->snapshots[s].status);
+        }
+        free(pbus->entries);
+        free(pbus->blocks);
+        free(pbus->block_regs);
+        free(pbus->msgs);
+        free(pbus->scratch);
+    }
+
+    pthread_cond_destroy(&poller->wake);
+    pthread_mutex_destroy(&poller->lock);
+    free(poller->buses);
+    free(poller->desc_entry);
+    free(poller->desc_bus);
+    free(poller->descs);
+    free(poller);
+}
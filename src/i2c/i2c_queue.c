@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "i2c/i2c_queue.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static struct {
+    pthread_mutex_t lock;
+    struct _i2c_queue* queues;
+} registry = { PTHREAD_MUTEX_INITIALIZER, NULL };
+
+static void*
+mraa_i2c_queue_worker(void* arg)
+{
+    struct _i2c_queue* queue = (struct _i2c_queue*) arg;
+    struct _i2c_queue_node* batch[MRAA_I2C_QUEUE_BATCH];
+
+    pthread_mutex_lock(&queue->lock);
+    for (;;) {
+        unsigned int num = 0;
+
+        while (queue->head == NULL && !queue->stop) {
+            pthread_cond_wait(&queue->work, &queue->lock);
+        }
+        if (queue->head == NULL) {
+            break;
+        }
+
+        while (queue->head != NULL && num < MRAA_I2C_QUEUE_BATCH) {
+            batch[num++] = queue->head;
+            queue->head = queue->head->next;
+        }
+        pthread_mutex_unlock(&queue->lock);
+
+        // Run the batch back to back, the queue stays open to submitters
+        for (unsigned int i = 0; i < num; ++i) {
+            mraa_i2c_job* job = batch[i]->job;
+            mraa_result_t result = mraa_i2c_transfer(batch[i]->dev, job->msgs, job->num_msgs);
+
+            if (batch[i]->cb != NULL) {
+                batch[i]->cb(job, result);
+            }
+        }
+
+        pthread_mutex_lock(&queue->lock);
+        for (unsigned int i = 0; i < num; ++i) {
+            batch[i]->dev->queued_jobs--;
+            free(batch[i]);
+        }
+        queue->depth -= num;
+        pthread_cond_broadcast(&queue->done);
+    }
+    pthread_mutex_unlock(&queue->lock);
+
+    return NULL;
+}
+
+struct _i2c_queue*
+mraa_i2c_queue_acquire(int busnum)
+{
+    struct _i2c_queue* queue;
+
+    pthread_mutex_lock(&registry.lock);
+    for (queue = registry.queues; queue != NULL; queue = queue->next) {
+        if (queue->busnum == busnum) {
+            queue->refcount++;
+            pthread_mutex_unlock(&registry.lock);
+            return queue;
+        }
+    }
+
+    queue = calloc(1, sizeof(struct _i2c_queue));
+    if (queue == NULL) {
+        syslog(LOG_CRIT, "i2c%i: submit: Failed to allocate memory for job queue", busnum);
+        pthread_mutex_unlock(&registry.lock);
+        return NULL;
+    }
+
+    queue->busnum = busnum;
+    queue->refcount = 1;
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->work, NULL);
+    pthread_cond_init(&queue->done, NULL);
+
+    if (pthread_create(&queue->thread, NULL, mraa_i2c_queue_worker, queue) != 0) {
+        syslog(LOG_ERR, "i2c%i: submit: Failed to start the job queue thread", busnum);
+        pthread_cond_destroy(&queue->done);
+        pthread_cond_destroy(&queue->work);
+        pthread_mutex_destroy(&queue->lock);
+        free(queue);
+        pthread_mutex_unlock(&registry.lock);
+        return NULL;
+    }
+
+    queue->next = registry.queues;
+    registry.queues = queue;
+    pthread_mutex_unlock(&registry.lock);
+
+    return queue;
+}
+
+void
+mraa_i2c_queue_release(struct _i2c_queue* queue)
+{
+    struct _i2c_queue** it;
+
+    if (queue == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&registry.lock);
+    if (--queue->refcount > 0) {
+        pthread_mutex_unlock(&registry.lock);
+        return;
+    }
+
+    for (it = &registry.queues; *it != NULL; it = &(*it)->next) {
+        if (*it == queue) {
+            *it = queue->next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&registry.lock);
+
+    // Every context waited for its jobs, the worker only has to leave
+    pthread_mutex_lock(&queue->lock);
+    queue->stop = 1;
+    pthread_cond_signal(&queue->work);
+    pthread_mutex_unlock(&queue->lock);
+    pthread_join(queue->thread, NULL);
+
+    pthread_cond_destroy(&queue->done);
+    pthread_cond_destroy(&queue->work);
+    pthread_mutex_destroy(&queue->lock);
+    free(queue);
+}
+
+mraa_result_t
+mraa_i2c_queue_push(struct _i2c_queue* queue, mraa_i2c_context dev, mraa_i2c_job* job, mraa_i2c_job_cb cb)
+{
+    struct _i2c_queue_node** it;
+    struct _i2c_queue_node* node = calloc(1, sizeof(struct _i2c_queue_node));
+    if (node == NULL) {
+        syslog(LOG_CRIT, "i2c%i: submit: Failed to allocate memory for job", dev->busnum);
+        return MRAA_ERROR_NO_RESOURCES;
+    }
+
+    node->job = job;
+    node->cb = cb;
+    node->dev = dev;
+
+    pthread_mutex_lock(&queue->lock);
+    // Behind every job of the same or a higher priority
+    for (it = &queue->head; *it != NULL && (*it)->job->priority >= job->priority; it = &(*it)->next)
+        ;
+    node->next = *it;
+    *it = node;
+    queue->depth++;
+    dev->queued_jobs++;
+    pthread_cond_signal(&queue->work);
+    pthread_mutex_unlock(&queue->lock);
+
+    return MRAA_SUCCESS;
+}
+
+unsigned int
+mraa_i2c_queue_count(struct _i2c_queue* queue)
+{
+    unsigned int depth;
+
+    pthread_mutex_lock(&queue->lock);
+    depth = queue->depth;
+    pthread_mutex_unlock(&queue->lock);
+
+    return depth;
+}
+
+mraa_result_t
+mraa_i2c_queue_wait(struct _i2c_queue* queue, mraa_i2c_context dev)
+{
+    // Callbacks run on the worker, the jobs they would wait for could never run
+    if (pthread_equal(pthread_self(), queue->thread)) {
+        syslog(LOG_ERR, "i2c%i: wait_jobs: Called from a job callback", dev->busnum);
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+
+    pthread_mutex_lock(&queue->lock);
+    while (dev->queued_jobs > 0) {
+        pthread_cond_wait(&queue->done, &queue->lock);
+    }
+    pthread_mutex_unlock(&queue->lock);
+
+    return MRAA_SUCCESS;
+}
@@ -57,6 +57,122 @@ mraa_init_json_platform_get_index(json_object* jobj, const char* io, const char*
     return MRAA_ERROR_NO_DATA_AVAILABLE;
 }
 
+/* Optional non negative key of the mmap object, fallback when missing. */
+static mraa_result_t
+mraa_init_json_platform_mmap_int(json_object* jobj_mmap, const char* key, int fallback, int* value)
+{
+    json_object* jobj_temp = NULL;
+
+    *value = fallback;
+    if (!json_object_object_get_ex(jobj_mmap, key, &jobj_temp)) {
+        return MRAA_SUCCESS;
+    }
+    if (!json_object_is_type(jobj_temp, json_type_int) || json_object_get_int(jobj_temp) < 0) {
+        syslog(LOG_ERR, "init_json_platform: %s %s is not a positive int", GPIO_MMAP_KEY, key);
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+    *value = json_object_get_int(jobj_temp);
+    return MRAA_SUCCESS;
+}
+
+mraa_result_t
+mraa_init_json_platform_gpio_mmap(json_object* jobj_platform, mraa_board_t* board)
+{
+    json_object* jobj_mmap = NULL;
+    json_object* jobj_temp = NULL;
+    mraa_gpio_mmap_desc_t* desc;
+    mraa_result_t ret = MRAA_SUCCESS;
+    int value = 0;
+
+    if (!json_object_object_get_ex(jobj_platform, GPIO_MMAP_KEY, &jobj_mmap)) {
+        return MRAA_SUCCESS;
+    }
+    if (!json_object_is_type(jobj_mmap, json_type_object)) {
+        syslog(LOG_ERR, "init_json_platform: %s is not an object", GPIO_MMAP_KEY);
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+    if (board->gpio_mmap != NULL) {
+        syslog(LOG_ERR, "init_json_platform: %s given by more than one platform entry", GPIO_MMAP_KEY);
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+
+    desc = (mraa_gpio_mmap_desc_t*) calloc(1, sizeof(mraa_gpio_mmap_desc_t));
+    if (desc == NULL) {
+        syslog(LOG_ERR, "init_json_platform: Unable to allocate space for %s", GPIO_MMAP_KEY);
+        return MRAA_ERROR_NO_RESOURCES;
+    }
+
+    if (!json_object_object_get_ex(jobj_mmap, MMAP_DEVICE_KEY, &jobj_temp) ||
+        !json_object_is_type(jobj_temp, json_type_string)) {
+        syslog(LOG_ERR, "init_json_platform: %s needs a \"%s\" string", GPIO_MMAP_KEY, MMAP_DEVICE_KEY);
+        ret = MRAA_ERROR_NO_DATA_AVAILABLE;
+        goto fail;
+    }
+    strncpy(desc->mem_dev, json_object_get_string(jobj_temp), sizeof(desc->mem_dev) - 1);
+
+    // The physical base does not always fit in an int
+    if (json_object_object_get_ex(jobj_mmap, MMAP_BASE_KEY, &jobj_temp)) {
+        if (!json_object_is_type(jobj_temp, json_type_int) || json_object_get_int64(jobj_temp) < 0) {
+            syslog(LOG_ERR, "init_json_platform: %s %s is not a positive int", GPIO_MMAP_KEY, MMAP_BASE_KEY);
+            ret = MRAA_ERROR_INVALID_RESOURCE;
+            goto fail;
+        }
+        desc->base = (uint64_t) json_object_get_int64(jobj_temp);
+    }
+
+    ret = mraa_init_json_platform_get_pin(jobj_mmap, GPIO_MMAP_KEY, MMAP_SIZE_KEY, 0, &value);
+    if (ret != MRAA_SUCCESS) {
+        goto fail;
+    }
+    desc->size = (unsigned int) value;
+
+    if ((ret = mraa_init_json_platform_mmap_int(jobj_mmap, MMAP_BANK_STRIDE_KEY, 4, &value)) != MRAA_SUCCESS) {
+        goto fail;
+    }
+    desc->bank_stride = (unsigned int) value;
+
+    if ((ret = mraa_init_json_platform_mmap_int(jobj_mmap, MMAP_LINES_PER_BANK_KEY, 32, &value)) != MRAA_SUCCESS) {
+        goto fail;
+    }
+    desc->lines_per_bank = (unsigned int) value;
+
+    if ((ret = mraa_init_json_platform_mmap_int(jobj_mmap, MMAP_LINE_BASE_KEY, 0, &desc->line_base)) != MRAA_SUCCESS) {
+        goto fail;
+    }
+
+    // Registers a port does not have are left at -1
+    if ((ret = mraa_init_json_platform_mmap_int(jobj_mmap, MMAP_SET_KEY, -1, &desc->set_offset)) != MRAA_SUCCESS ||
+        (ret = mraa_init_json_platform_mmap_int(jobj_mmap, MMAP_CLEAR_KEY, -1, &desc->clear_offset)) != MRAA_SUCCESS ||
+        (ret = mraa_init_json_platform_mmap_int(jobj_mmap, MMAP_DATA_KEY, -1, &desc->data_offset)) != MRAA_SUCCESS ||
+        (ret = mraa_init_json_platform_mmap_int(jobj_mmap, MMAP_LEVEL_KEY, -1, &desc->level_offset)) != MRAA_SUCCESS ||
+        (ret = mraa_init_json_platform_mmap_int(jobj_mmap, MMAP_DIR_KEY, -1, &desc->dir_offset)) != MRAA_SUCCESS) {
+        goto fail;
+    }
+
+    if (json_object_object_get_ex(jobj_mmap, MMAP_DIR_OUT_HIGH_KEY, &jobj_temp)) {
+        if (!json_object_is_type(jobj_temp, json_type_boolean)) {
+            syslog(LOG_ERR, "init_json_platform: %s %s is not a boolean", GPIO_MMAP_KEY, MMAP_DIR_OUT_HIGH_KEY);
+            ret = MRAA_ERROR_INVALID_RESOURCE;
+            goto fail;
+        }
+        desc->dir_out_high = json_object_get_boolean(jobj_temp) ? 1 : 0;
+    }
+
+    if (desc->data_offset == -1 && (desc->set_offset == -1 || desc->clear_offset == -1)) {
+        syslog(LOG_ERR, "init_json_platform: %s needs a %s register or both %s and %s", GPIO_MMAP_KEY,
+               MMAP_DATA_KEY, MMAP_SET_KEY, MMAP_CLEAR_KEY);
+        ret = MRAA_ERROR_INVALID_RESOURCE;
+        goto fail;
+    }
+
+    board->gpio_mmap = desc;
+    return MRAA_SUCCESS;
+
+fail:
+    free(desc);
+    return ret;
+}
+
 mraa_result_t
 mraa_init_json_platform_platform(json_object* jobj_platform, mraa_board_t* board, int index)
 {
@@ -173,6 +289,12 @@ mraa_init_json_platform_platform(json_object* jobj_platform, mraa_board_t* board
                         "configuration");
         return MRAA_ERROR_INVALID_RESOURCE;
     }
+    // Optional register layout for mraa_gpio_use_mmaped()
+    ret = mraa_init_json_platform_gpio_mmap(jobj_platform, board);
+    if (ret != MRAA_SUCCESS) {
+        return ret;
+    }
+
     // Set our platform type
     board->platform_type = MRAA_JSON_PLATFORM;
     board->adv_func = (mraa_adv_func_t*) calloc(1, sizeof(mraa_adv_func_t));
@@ -720,6 +842,7 @@ mraa_init_json_platform(const char* platform_json)
 unsuccessful:
     free(board->platform_name);
     free(board->pins);
+    free(board->gpio_mmap);
     free(board->adv_func);
     free(board);
 cleanup:
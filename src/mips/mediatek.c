@@ -24,101 +24,34 @@
 #define MT7628_GPIO_CLEAR       0x640
 
 // MMAP
-static uint8_t *mmap_reg = NULL;
-static int mmap_fd = 0;
-static int mmap_size;
 static uint8_t *gpio_mmap_reg = NULL;
 static int gpio_mmap_fd = 0;
-static unsigned int mmap_count = 0;
 
-static mraa_result_t
-mtk_mmap_write(mraa_gpio_context dev, int value)
-{
-    if (value) {
-        *(volatile uint32_t*) (mmap_reg + MT7628_GPIO_SET + (dev->pin / 32) * 4) =
-            (uint32_t)(1 << (dev->pin % 32));
-    } else {
-        *(volatile uint32_t*) (mmap_reg + MT7628_GPIO_CLEAR + (dev->pin / 32) * 4) =
-            (uint32_t)(1 << (dev->pin % 32));
-    }
-    return MRAA_SUCCESS;
-}
-
-static mraa_result_t
-mtk_mmap_unsetup()
-{
-    if (mmap_reg == NULL) {
-        syslog(LOG_ERR, "linkit mmap: null register cant unsetup");
-        return MRAA_ERROR_INVALID_RESOURCE;
-    }
-    munmap(mmap_reg, mmap_size);
-    mmap_reg = NULL;
-    if (close(mmap_fd) != 0) {
-        return MRAA_ERROR_INVALID_RESOURCE;
-    }
-    return MRAA_SUCCESS;
-}
-
-static int
-mtk_mmap_read(mraa_gpio_context dev)
-{
-    uint32_t value = *(volatile uint32_t*) (mmap_reg + MT7628_GPIO_DATA + (dev->pin / 32) * 4);
-    if (value & (uint32_t)(1 << (dev->pin % 32))) {
-        return 1;
-    }
-    return MRAA_SUCCESS;
-}
-
-static mraa_result_t
-mtk_mmap_setup(mraa_gpio_context dev, mraa_boolean_t en)
+/*
+ * Describe the GPIO registers for the generic mmap engine.
+ */
+static mraa_gpio_mmap_desc_t*
+mtk_gpio_mmap_desc(void)
 {
-    if (dev == NULL) {
-        syslog(LOG_ERR, "linkit mmap: context not valid");
-        return MRAA_ERROR_INVALID_HANDLE;
-    }
-
-    if (en == 0) {
-        if (dev->mmap_write == NULL && dev->mmap_read == NULL) {
-            syslog(LOG_ERR, "linkit mmap: can't disable disabled mmap gpio");
-            return MRAA_ERROR_INVALID_PARAMETER;
-        }
-        dev->mmap_write = NULL;
-        dev->mmap_read = NULL;
-        mmap_count--;
-        if (mmap_count == 0) {
-            return mtk_mmap_unsetup();
-        }
-        return MRAA_SUCCESS;
-    }
-
-    if (dev->mmap_write != NULL && dev->mmap_read != NULL) {
-        syslog(LOG_ERR, "linkit mmap: can't enable enabled mmap gpio");
-        return MRAA_ERROR_INVALID_PARAMETER;
-    }
-
-    // Might need to make some elements of this thread safe.
-    // For example only allow one thread to enter the following block
-    // to prevent mmap'ing twice.
-    if (mmap_reg == NULL) {
-        if ((mmap_fd = open(MMAP_PATH, O_RDWR)) < 0) {
-            syslog(LOG_ERR, "linkit map: unable to open %s", MMAP_PATH);
-            return MRAA_ERROR_INVALID_HANDLE;
-        }
-
-        mmap_reg = (uint8_t*) mmap(NULL, MT7628_BLOCK_SIZE, PROT_READ | PROT_WRITE,
-                                   MAP_FILE | MAP_SHARED, mmap_fd, 0x10000000);
-        if (mmap_reg == MAP_FAILED) {
-            syslog(LOG_ERR, "linkit mmap: failed to mmap");
-            mmap_reg = NULL;
-            close(mmap_fd);
-            return MRAA_ERROR_NO_RESOURCES;
-        }
+    mraa_gpio_mmap_desc_t* desc = (mraa_gpio_mmap_desc_t*) calloc(1, sizeof(mraa_gpio_mmap_desc_t));
+    if (desc == NULL) {
+        return NULL;
     }
-    dev->mmap_write = &mtk_mmap_write;
-    dev->mmap_read = &mtk_mmap_read;
-    mmap_count++;
 
-    return MRAA_SUCCESS;
+    strncpy(desc->mem_dev, MMAP_PATH, sizeof(desc->mem_dev) - 1);
+    desc->base = MT7628_GPIOMODE_BASE;
+    desc->size = MT7628_BLOCK_SIZE;
+    desc->bank_stride = 4;
+    desc->lines_per_bank = 32;
+    desc->line_base = 0;
+    desc->set_offset = MT7628_GPIO_SET;
+    desc->clear_offset = MT7628_GPIO_CLEAR;
+    desc->data_offset = MT7628_GPIO_DATA;
+    desc->level_offset = -1;
+    desc->dir_offset = MT7628_GPIO_CTRL;
+    desc->dir_out_high = 1;
+
+    return desc;
 }
 
 static mraa_result_t
@@ -416,7 +349,7 @@ mtk_common(char *name, int pin_count)
     memset(b->pins, 0, sizeof(mraa_pininfo_t) * b->phy_pin_count);
     memset(gpio_mux_groups, -1, sizeof(gpio_mux_groups));
 
-    b->adv_func->gpio_mmap_setup = &mtk_mmap_setup;
+    b->gpio_mmap = mtk_gpio_mmap_desc();
 
     for (i = 0; i < b->phy_pin_count; i++) {
         snprintf(b->pins[i].name, MRAA_PIN_NAME_SIZE, "GPIO%d", i);
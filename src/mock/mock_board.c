@@ -98,6 +98,7 @@ mraa_mock_board()
     b->adv_func->i2c_write_byte_replace = &mraa_mock_i2c_write_byte_replace;
     b->adv_func->i2c_write_byte_data_replace = &mraa_mock_i2c_write_byte_data_replace;
     b->adv_func->i2c_write_word_data_replace = &mraa_mock_i2c_write_word_data_replace;
+    b->adv_func->i2c_transfer_replace = &mraa_mock_i2c_transfer_replace;
     b->adv_func->spi_init_raw_replace = &mraa_mock_spi_init_raw_replace;
     b->adv_func->spi_stop_replace = &mraa_mock_spi_stop_replace;
     b->adv_func->spi_bit_per_word_replace = &mraa_mock_spi_bit_per_word_replace;
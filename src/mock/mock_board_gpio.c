@@ -41,21 +41,30 @@ mraa_mock_gpio_close_replace(mraa_gpio_context dev)
 mraa_result_t
 mraa_mock_gpio_dir_replace(mraa_gpio_context dev, mraa_gpio_dir_t dir)
 {
-    switch (dir) {
-        case MRAA_GPIO_OUT_HIGH:
-            dev->mock_dir = MRAA_GPIO_OUT;
-            return mraa_gpio_write(dev, 1);
-        case MRAA_GPIO_OUT_LOW:
-            dev->mock_dir = MRAA_GPIO_OUT;
-            return mraa_gpio_write(dev, 0);
-        case MRAA_GPIO_IN:
-        case MRAA_GPIO_OUT:
-            dev->mock_dir = dir;
-            return MRAA_SUCCESS;
-        default:
-            syslog(LOG_ERR, "gpio: dir: invalid direction '%d' to set", (int) dir);
-            return MRAA_ERROR_INVALID_PARAMETER;
+    mraa_result_t ret = MRAA_SUCCESS;
+
+    // Like sysfs, every pin of an mraa_gpio_init_multi() context changes
+    for (mraa_gpio_context it = dev; it != NULL && ret == MRAA_SUCCESS; it = it->next) {
+        switch (dir) {
+            case MRAA_GPIO_OUT_HIGH:
+                it->mock_dir = MRAA_GPIO_OUT;
+                ret = mraa_gpio_write(it, 1);
+                break;
+            case MRAA_GPIO_OUT_LOW:
+                it->mock_dir = MRAA_GPIO_OUT;
+                ret = mraa_gpio_write(it, 0);
+                break;
+            case MRAA_GPIO_IN:
+            case MRAA_GPIO_OUT:
+                it->mock_dir = dir;
+                break;
+            default:
+                syslog(LOG_ERR, "gpio: dir: invalid direction '%d' to set", (int) dir);
+                return MRAA_ERROR_INVALID_PARAMETER;
+        }
     }
+
+    return ret;
 }
 
 mraa_result_t
@@ -224,3 +224,36 @@ mraa_mock_i2c_write_word_data_replace(mraa_i2c_context dev, const uint16_t data,
         return MRAA_ERROR_UNSPECIFIED;
     }
 }
+
+mraa_result_t
+mraa_mock_i2c_transfer_replace(mraa_i2c_context dev, mraa_i2c_msg msgs[], unsigned int num_msgs)
+{
+    // The mock device has a register pointer, set by the first byte of a write
+    uint8_t reg = 0;
+
+    for (unsigned int i = 0; i < num_msgs; ++i) {
+        if (msgs[i].addr != dev->mock_dev_addr) {
+            // Not our mock device, nobody acks
+            return MRAA_ERROR_UNSPECIFIED;
+        }
+
+        for (int j = 0; j < msgs[i].len; ++j) {
+            if (!(msgs[i].flags & MRAA_I2C_MSG_READ) && j == 0 && !(msgs[i].flags & MRAA_I2C_MSG_NOSTART)) {
+                reg = msgs[i].buf[0];
+                continue;
+            }
+            if (reg >= dev->mock_dev_data_len) {
+                syslog(LOG_ERR, "i2c%i: transfer: Command/register number is too big, max is 0x%X",
+                       dev->busnum, dev->mock_dev_data_len - 1);
+                return MRAA_ERROR_UNSPECIFIED;
+            }
+            if (msgs[i].flags & MRAA_I2C_MSG_READ) {
+                msgs[i].buf[j] = dev->mock_dev_data[reg++];
+            } else {
+                dev->mock_dev_data[reg++] = msgs[i].buf[j];
+            }
+        }
+    }
+
+    return MRAA_SUCCESS;
+}
@@ -29,6 +29,7 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <sys/utsname.h>
+#include <time.h>
 #include <unistd.h>
 
 #if defined(IMRAA)
@@ -41,6 +42,8 @@
 #include "firmata/firmata_mraa.h"
 #include "gpio.h"
 #include "gpio/gpio_chardev.h"
+#include "gpio/gpio_mux.h"
+#include "gpio/gpio_shadow.h"
 #include "grovepi/grovepi.h"
 #include "i2c.h"
 #include "mraa_internal.h"
@@ -92,6 +95,12 @@ mraa_is_kernel_chardev_interface_compatible()
         return 0;
     }
 
+    if (!mraa_is_gpiod_v2_capable()) {
+        syslog(LOG_NOTICE,
+               "gpio: kernel lacks the GPIO v2 chardev ABI, falling back to sysfs");
+        return 0;
+    }
+
     return 1;
 }
 
@@ -257,12 +266,18 @@ void
 mraa_deinit()
 {
     if (plat != NULL) {
+        // pooled mux contexts close through the platform hooks
+        mraa_gpio_mux_cleanup();
+
         if (plat->pins != NULL) {
             free(plat->pins);
         }
         if (plat->adv_func != NULL) {
             free(plat->adv_func);
         }
+        if (plat->gpio_mmap != NULL) {
+            free(plat->gpio_mmap);
+        }
         mraa_board_t* sub_plat = plat->sub_platform;
         /* No alloc's in an FTDI_FT4222 platform structure */
         if ((sub_plat != NULL) && (sub_plat->platform_type != MRAA_FTDI_FT4222)) {
@@ -306,6 +321,8 @@ mraa_deinit()
             free(platform_name);
             platform_name = NULL;
         }
+
+        mraa_gpio_shadow_free();
     }
 #if !defined(PERIPHERALMAN)
     if (plat_iio != NULL) {
@@ -319,18 +336,33 @@ mraa_deinit()
 }
 
 int
-mraa_set_priority(const int priority)
+mraa_set_scheduler(const int policy, const int priority)
 {
     struct sched_param sched_s;
 
     memset(&sched_s, 0, sizeof(struct sched_param));
-    if (priority > sched_get_priority_max(SCHED_RR)) {
-        sched_s.sched_priority = sched_get_priority_max(SCHED_RR);
+    if (priority > sched_get_priority_max(policy)) {
+        sched_s.sched_priority = sched_get_priority_max(policy);
     } else {
         sched_s.sched_priority = priority;
     }
 
-    return sched_setscheduler(0, SCHED_RR, &sched_s);
+    return sched_setscheduler(0, policy, &sched_s);
+}
+
+uint64_t
+mraa_monotonic_ns()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t) now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+int
+mraa_set_priority(const int priority)
+{
+    return mraa_set_scheduler(SCHED_RR, priority);
 }
 
 #if !defined(PERIPHERALMAN)
@@ -385,176 +417,12 @@ mraa_iio_detect()
 mraa_result_t
 mraa_setup_mux_mapped(mraa_pin_t meta)
 {
-    unsigned int mi;
-    mraa_result_t ret;
-    mraa_gpio_context mux_i = NULL;
-    // avoids the unsigned comparison and we should never have a pin that is UINT_MAX!
-    unsigned int last_pin = UINT_MAX;
-
-    for (mi = 0; mi < meta.mux_total; mi++) {
-
-        switch (meta.mux[mi].pincmd) {
-            case PINCMD_UNDEFINED: // used for backward compatibility
-                if (meta.mux[mi].pin != last_pin) {
-                    if (mux_i != NULL) {
-                        mraa_gpio_owner(mux_i, 0);
-                        mraa_gpio_close(mux_i);
-                    }
-                    mux_i = mraa_gpio_init_raw(meta.mux[mi].pin);
-                    if (mux_i == NULL)
-                        return MRAA_ERROR_INVALID_HANDLE;
-                    last_pin = meta.mux[mi].pin;
-                }
-                // this function will sometimes fail, however this is not critical as
-                // long as the write succeeds - Test case galileo gen2 pin2
-                mraa_gpio_dir(mux_i, MRAA_GPIO_OUT);
-                ret = mraa_gpio_write(mux_i, meta.mux[mi].value);
-                if (ret != MRAA_SUCCESS) {
-                    if (mux_i != NULL) {
-                        mraa_gpio_owner(mux_i, 0);
-                        mraa_gpio_close(mux_i);
-                    }
-                    return MRAA_ERROR_INVALID_RESOURCE;
-                }
-                break;
-
-            case PINCMD_SET_VALUE:
-                if (meta.mux[mi].pin != last_pin) {
-                    if (mux_i != NULL) {
-                        mraa_gpio_owner(mux_i, 0);
-                        mraa_gpio_close(mux_i);
-                    }
-                    mux_i = mraa_gpio_init_raw(meta.mux[mi].pin);
-                    if (mux_i == NULL)
-                        return MRAA_ERROR_INVALID_HANDLE;
-                    last_pin = meta.mux[mi].pin;
-                }
-
-                ret = mraa_gpio_write(mux_i, meta.mux[mi].value);
-
-                if (ret != MRAA_SUCCESS) {
-                    if (mux_i != NULL) {
-                        mraa_gpio_owner(mux_i, 0);
-                        mraa_gpio_close(mux_i);
-                    }
-                    return MRAA_ERROR_INVALID_RESOURCE;
-                }
-                break;
-
-            case PINCMD_SET_DIRECTION:
-                if (meta.mux[mi].pin != last_pin) {
-                    if (mux_i != NULL) {
-                        mraa_gpio_owner(mux_i, 0);
-                        mraa_gpio_close(mux_i);
-                    }
-                    mux_i = mraa_gpio_init_raw(meta.mux[mi].pin);
-                    if (mux_i == NULL)
-                        return MRAA_ERROR_INVALID_HANDLE;
-                    last_pin = meta.mux[mi].pin;
-                }
-
-                ret = mraa_gpio_dir(mux_i, meta.mux[mi].value);
-
-                if (ret != MRAA_SUCCESS) {
-                    if (mux_i != NULL) {
-                        mraa_gpio_owner(mux_i, 0);
-                        mraa_gpio_close(mux_i);
-                    }
-                    return MRAA_ERROR_INVALID_RESOURCE;
-                }
-                break;
-
-            case PINCMD_SET_IN_VALUE:
-                if (meta.mux[mi].pin != last_pin) {
-                    if (mux_i != NULL) {
-                        mraa_gpio_owner(mux_i, 0);
-                        mraa_gpio_close(mux_i);
-                    }
-                    mux_i = mraa_gpio_init_raw(meta.mux[mi].pin);
-                    if (mux_i == NULL)
-                        return MRAA_ERROR_INVALID_HANDLE;
-                    last_pin = meta.mux[mi].pin;
-                }
-
-                ret = mraa_gpio_dir(mux_i, MRAA_GPIO_IN);
-
-                if (ret == MRAA_SUCCESS)
-                    ret = mraa_gpio_write(mux_i, meta.mux[mi].value);
-
-                if (ret != MRAA_SUCCESS) {
-                    if (mux_i != NULL) {
-                        mraa_gpio_owner(mux_i, 0);
-                        mraa_gpio_close(mux_i);
-                    }
-                    return MRAA_ERROR_INVALID_RESOURCE;
-                }
-                break;
-
-            case PINCMD_SET_OUT_VALUE:
-                if (meta.mux[mi].pin != last_pin) {
-                    if (mux_i != NULL) {
-                        mraa_gpio_owner(mux_i, 0);
-                        mraa_gpio_close(mux_i);
-                    }
-                    mux_i = mraa_gpio_init_raw(meta.mux[mi].pin);
-                    if (mux_i == NULL)
-                        return MRAA_ERROR_INVALID_HANDLE;
-                    last_pin = meta.mux[mi].pin;
-                }
-
-                ret = mraa_gpio_dir(mux_i, MRAA_GPIO_OUT);
-
-                if (ret == MRAA_SUCCESS)
-                    ret = mraa_gpio_write(mux_i, meta.mux[mi].value);
-
-                if (ret != MRAA_SUCCESS) {
-                    if (mux_i != NULL) {
-                        mraa_gpio_owner(mux_i, 0);
-                        mraa_gpio_close(mux_i);
-                    }
-                    return MRAA_ERROR_INVALID_RESOURCE;
-                }
-                break;
-
-            case PINCMD_SET_MODE:
-                if (meta.mux[mi].pin != last_pin) {
-                    if (mux_i != NULL) {
-                        mraa_gpio_owner(mux_i, 0);
-                        mraa_gpio_close(mux_i);
-                    }
-                    mux_i = mraa_gpio_init_raw(meta.mux[mi].pin);
-                    if (mux_i == NULL)
-                        return MRAA_ERROR_INVALID_HANDLE;
-                    last_pin = meta.mux[mi].pin;
-                }
-
-                ret = mraa_gpio_mode(mux_i, meta.mux[mi].value);
-
-                if (ret != MRAA_SUCCESS) {
-                    if (mux_i != NULL) {
-                        mraa_gpio_owner(mux_i, 0);
-                        mraa_gpio_close(mux_i);
-                    }
-                    return MRAA_ERROR_INVALID_RESOURCE;
-                }
-                break;
-
-            case PINCMD_SKIP:
-                break;
-
-            default:
-                syslog(LOG_NOTICE, "mraa_setup_mux_mapped: wrong command %d on pin %d with value %d",
-                       meta.mux[mi].pincmd, meta.mux[mi].pin, meta.mux[mi].value);
-                break;
-        }
-    }
-
-    if (mux_i != NULL) {
-        mraa_gpio_owner(mux_i, 0);
-        mraa_gpio_close(mux_i);
+    mraa_gpio_mux_plan_t plan = mraa_gpio_mux_plan_get(&meta);
+    if (plan == NULL) {
+        return MRAA_ERROR_NO_RESOURCES;
     }
 
-    return MRAA_SUCCESS;
+    return mraa_gpio_mux_plan_run(plan);
 }
 #else
 mraa_result_t
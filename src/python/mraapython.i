@@ -142,6 +142,115 @@ class Spi;
    free($2);
 }
 
+// I2c::transfer(), a list of (addr, flags, bytearray), read messages fill their bytearray
+
+%typemap(in) (mraa_i2c_msg* msgs, unsigned int num_msgs) {
+   if (!PyList_Check($input)) {
+       PyErr_SetString(PyExc_ValueError, "list of (addr, flags, bytearray) expected");
+       SWIG_fail;
+   }
+   $2 = PyList_Size($input);
+   $1 = (mraa_i2c_msg*) calloc($2 > 0 ? $2 : 1, sizeof(mraa_i2c_msg));
+   if ($1 == NULL) {
+       PyErr_NoMemory();
+       SWIG_fail;
+   }
+   for (unsigned int i = 0; i < $2; ++i) {
+       PyObject* msg = PyList_GetItem($input, i);
+       if (!PyTuple_Check(msg) || PyTuple_Size(msg) != 3 || !PyByteArray_Check(PyTuple_GetItem(msg, 2)) ||
+           PyByteArray_Size(PyTuple_GetItem(msg, 2)) > 0xffff) {
+           PyErr_SetString(PyExc_ValueError, "list of (addr, flags, bytearray) expected");
+           SWIG_fail;
+       }
+       $1[i].addr = (uint16_t) PyInt_AsLong(PyTuple_GetItem(msg, 0));
+       $1[i].flags = (uint16_t) PyInt_AsLong(PyTuple_GetItem(msg, 1));
+       $1[i].len = (uint16_t) PyByteArray_Size(PyTuple_GetItem(msg, 2));
+       $1[i].buf = (uint8_t*) PyByteArray_AsString(PyTuple_GetItem(msg, 2));
+   }
+}
+
+%typemap(freearg) (mraa_i2c_msg* msgs, unsigned int num_msgs) {
+   free($1);
+}
+
+%ignore mraa::I2c::transfer(std::vector<mraa_i2c_msg>& msgs);
+
+// I2c::readBytesReg16() returns a bytearray, like I2c::readBytesReg()
+
+%typemap(out) std::vector<uint8_t> {
+   $result = PyByteArray_FromStringAndSize((char*) $1.data(), $1.size());
+}
+
+// I2c::writeBytesReg16()
+
+%typemap(in) const std::vector<uint8_t>& (std::vector<uint8_t> temp) {
+   if (!PyByteArray_Check($input)) {
+       PyErr_SetString(PyExc_ValueError, "bytearray expected");
+       SWIG_fail;
+   }
+   uint8_t* bytes = (uint8_t*) PyByteArray_AsString($input);
+   temp.assign(bytes, bytes + PyByteArray_Size($input));
+   $1 = &temp;
+}
+
+// I2c::readWordsReg() returns a list of ints
+
+%typemap(out) std::vector<uint16_t> {
+   $result = PyList_New($1.size());
+   for (size_t i = 0; i < $1.size(); ++i) {
+       PyList_SetItem($result, i, PyInt_FromLong($1[i]));
+   }
+}
+
+// I2c::writeWordsReg() takes a list of ints
+
+%typemap(typecheck, precedence=SWIG_TYPECHECK_POINTER) const std::vector<uint16_t>& {
+   $1 = PyList_Check($input) ? 1 : 0;
+}
+
+%typemap(in) const std::vector<uint16_t>& (std::vector<uint16_t> temp) {
+   if (!PyList_Check($input)) {
+       PyErr_SetString(PyExc_ValueError, "list of 16-bit words expected");
+       SWIG_fail;
+   }
+   for (Py_ssize_t i = 0; i < PyList_Size($input); ++i) {
+       long word = PyInt_AsLong(PyList_GetItem($input, i));
+       if (word < 0 || word > 0xffff) {
+           PyErr_SetString(PyExc_ValueError, "list of 16-bit words expected");
+           SWIG_fail;
+       }
+       temp.push_back((uint16_t) word);
+   }
+   $1 = &temp;
+}
+
+// I2c::readRegBlocks(), a list of (reg, bytearray), each bytearray is filled in place
+
+%typemap(typecheck, precedence=SWIG_TYPECHECK_POINTER) std::vector<mraa_i2c_reg_block>& {
+   $1 = PyList_Check($input) ? 1 : 0;
+}
+
+%typemap(in) std::vector<mraa_i2c_reg_block>& (std::vector<mraa_i2c_reg_block> temp) {
+   if (!PyList_Check($input)) {
+       PyErr_SetString(PyExc_ValueError, "list of (reg, bytearray) expected");
+       SWIG_fail;
+   }
+   for (Py_ssize_t i = 0; i < PyList_Size($input); ++i) {
+       PyObject* range = PyList_GetItem($input, i);
+       if (!PyTuple_Check(range) || PyTuple_Size(range) != 2 || !PyByteArray_Check(PyTuple_GetItem(range, 1)) ||
+           PyByteArray_Size(PyTuple_GetItem(range, 1)) > 0xffff) {
+           PyErr_SetString(PyExc_ValueError, "list of (reg, bytearray) expected");
+           SWIG_fail;
+       }
+       mraa_i2c_reg_block block;
+       block.reg = (uint16_t) PyInt_AsLong(PyTuple_GetItem(range, 0));
+       block.len = (uint16_t) PyByteArray_Size(PyTuple_GetItem(range, 1));
+       block.buf = (uint8_t*) PyByteArray_AsString(PyTuple_GetItem(range, 1));
+       temp.push_back(block);
+   }
+   $1 = &temp;
+}
+
 %include ../mraa.i
 
 %init %{
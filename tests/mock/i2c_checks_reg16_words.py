@@ -0,0 +1,109 @@
+#!/usr/bin/env python
+
+# Copyright (c) 2026 Intel Corporation.
+#
+# SPDX-License-Identifier: MIT
+
+import mraa as m
+import unittest as u
+
+from i2c_checks_shared import *
+
+# The mock device has 8-bit registers: of a 16-bit register address, the high
+# byte sent first selects the register and the low byte is written into it.
+
+class I2cChecksReg16Words(u.TestCase):
+  def setUp(self):
+    self.i2c = m.I2c(MRAA_I2C_BUS_NUM)
+    self.i2c.address(MRAA_MOCK_I2C_ADDR)
+
+  def tearDown(self):
+    del self.i2c
+
+  def test_i2c_write_bytes_reg16(self):
+    self.assertEqual(self.i2c.writeBytesReg16(0x0203, bytearray([0x44, 0x55])),
+                     m.SUCCESS,
+                     "I2C writeBytesReg16() failed")
+    self.assertEqual(self.i2c.readBytesReg(0x02, 3),
+                     bytearray([0x03, 0x44, 0x55]),
+                     "I2C writeBytesReg16() did not send the register big-endian")
+
+  def test_i2c_read_bytes_reg16(self):
+    self.i2c.write(bytearray([0x02, 0x11, 0x22]))
+    self.assertEqual(self.i2c.readBytesReg16(0x0105, 2),
+                     bytearray([0x11, 0x22]),
+                     "I2C readBytesReg16() returned unexpected data")
+    self.assertEqual(self.i2c.readReg(0x01), 0x05,
+                     "I2C readBytesReg16() did not send the register big-endian")
+
+  def test_i2c_read_bytes_reg16_invalid_reg(self):
+    self.assertRaises(ValueError, self.i2c.readBytesReg16, (MRAA_MOCK_I2C_DATA_LEN << 8), 1)
+
+  def test_i2c_write_words_big_endian(self):
+    self.assertEqual(self.i2c.writeWordsReg(0x02, [0x1234, 0xABCD], m.I2C_BIG_ENDIAN),
+                     m.SUCCESS,
+                     "I2C writeWordsReg() failed")
+    self.assertEqual(self.i2c.readBytesReg(0x02, 4),
+                     bytearray([0x12, 0x34, 0xAB, 0xCD]),
+                     "I2C writeWordsReg() big-endian wrote unexpected bytes")
+
+  def test_i2c_write_words_little_endian(self):
+    self.assertEqual(self.i2c.writeWordsReg(0x02, [0x1234, 0xABCD], m.I2C_LITTLE_ENDIAN),
+                     m.SUCCESS,
+                     "I2C writeWordsReg() failed")
+    self.assertEqual(self.i2c.readBytesReg(0x02, 4),
+                     bytearray([0x34, 0x12, 0xCD, 0xAB]),
+                     "I2C writeWordsReg() little-endian wrote unexpected bytes")
+
+  def test_i2c_write_words_default_big_endian(self):
+    self.i2c.writeWordsReg(0x02, [0x1234])
+    self.assertEqual(self.i2c.readBytesReg(0x02, 2),
+                     bytearray([0x12, 0x34]),
+                     "I2C writeWordsReg() is not big-endian by default")
+
+  def test_i2c_read_words(self):
+    self.i2c.write(bytearray([0x02, 0x12, 0x34, 0x56, 0x78]))
+    self.assertEqual(self.i2c.readWordsReg(0x02, 2, m.I2C_BIG_ENDIAN),
+                     [0x1234, 0x5678],
+                     "I2C readWordsReg() big-endian returned unexpected words")
+    self.assertEqual(self.i2c.readWordsReg(0x02, 2, m.I2C_LITTLE_ENDIAN),
+                     [0x3412, 0x7856],
+                     "I2C readWordsReg() little-endian returned unexpected words")
+
+  def test_i2c_read_words_past_last_reg(self):
+    self.assertRaises(ValueError, self.i2c.readWordsReg, MRAA_MOCK_I2C_DATA_LEN - 2, 2)
+
+  def test_i2c_write_words_invalid(self):
+    self.assertRaises(ValueError, self.i2c.writeWordsReg, 0x02, [0x10000])
+
+  def test_i2c_read_reg_blocks(self):
+    self.i2c.write(bytearray([0x00] + [0xE0 + i for i in range(MRAA_MOCK_I2C_DATA_LEN - 1)]))
+    first = bytearray(2)
+    second = bytearray(3)
+    self.assertEqual(self.i2c.readRegBlocks([(0x01, first), (0x06, second)]),
+                     m.SUCCESS,
+                     "I2C readRegBlocks() failed")
+    self.assertEqual(first, bytearray([0xE1, 0xE2]), "I2C readRegBlocks() first range unexpected")
+    self.assertEqual(second, bytearray([0xE6, 0xE7, 0xE8]), "I2C readRegBlocks() second range unexpected")
+
+  def test_i2c_read_reg_blocks_reg16(self):
+    self.i2c.write(bytearray([0x02, 0x11, 0x22]))
+    block = bytearray(2)
+    self.assertEqual(self.i2c.readRegBlocks([(0x0107, block)], True),
+                     m.SUCCESS,
+                     "I2C readRegBlocks() with 16-bit registers failed")
+    self.assertEqual(block, bytearray([0x11, 0x22]), "I2C readRegBlocks() with 16-bit registers unexpected")
+    self.assertEqual(self.i2c.readReg(0x01), 0x07,
+                     "I2C readRegBlocks() did not send the register big-endian")
+
+  def test_i2c_read_reg_blocks_invalid(self):
+    self.assertEqual(self.i2c.readRegBlocks([(0x100, bytearray(1))]),
+                     m.ERROR_INVALID_PARAMETER,
+                     "I2C readRegBlocks() accepted a 16-bit register without reg16")
+    self.assertEqual(self.i2c.readRegBlocks([]),
+                     m.ERROR_INVALID_PARAMETER,
+                     "I2C readRegBlocks() accepted no ranges")
+    self.assertRaises(ValueError, self.i2c.readRegBlocks, [(0x01, 2)])
+
+if __name__ == "__main__":
+  u.main()
@@ -0,0 +1,70 @@
+#!/usr/bin/env python
+
+# Copyright (c) 2026 Intel Corporation.
+#
+# SPDX-License-Identifier: MIT
+
+import mraa as m
+import unittest as u
+
+from i2c_checks_shared import *
+
+class I2cChecksTransfer(u.TestCase):
+  def setUp(self):
+    self.i2c = m.I2c(MRAA_I2C_BUS_NUM)
+
+  def tearDown(self):
+    del self.i2c
+
+  def test_i2c_transfer_write_read(self):
+    # Write registers 2-4, then point back at 1 and read 1-4 without a stop in between
+    data_to_write = bytearray([0x02, 0x11, 0x22, 0x33])
+    self.assertEqual(self.i2c.transfer([(MRAA_MOCK_I2C_ADDR, 0, data_to_write)]),
+                     m.SUCCESS,
+                     "I2C transfer() write failed")
+    read_back = bytearray(4)
+    self.assertEqual(self.i2c.transfer([(MRAA_MOCK_I2C_ADDR, 0, bytearray([0x01])),
+                                        (MRAA_MOCK_I2C_ADDR, m.I2C_MSG_READ, read_back)]),
+                     m.SUCCESS,
+                     "I2C transfer() write/read failed")
+    self.assertEqual(read_back,
+                     bytearray([MRAA_MOCK_I2C_DATA_INIT_BYTE, 0x11, 0x22, 0x33]),
+                     "I2C transfer() read unexpected data")
+
+  def test_i2c_transfer_nostart(self):
+    # The second message continues the first one, its first byte is data, not a register
+    self.assertEqual(self.i2c.transfer([(MRAA_MOCK_I2C_ADDR, 0, bytearray([0x04, 0x44])),
+                                        (MRAA_MOCK_I2C_ADDR, m.I2C_MSG_NOSTART, bytearray([0x55, 0x66]))]),
+                     m.SUCCESS,
+                     "I2C transfer() with NOSTART failed")
+    self.i2c.address(MRAA_MOCK_I2C_ADDR)
+    self.assertEqual(self.i2c.readBytesReg(0x04, 3),
+                     bytearray([0x44, 0x55, 0x66]),
+                     "I2C transfer() with NOSTART wrote unexpected data")
+
+  def test_i2c_transfer_invalid_addr(self):
+    read_back = bytearray(2)
+    self.assertEqual(self.i2c.transfer([(MRAA_MOCK_I2C_ADDR - 1, 0, bytearray([0x00])),
+                                        (MRAA_MOCK_I2C_ADDR - 1, m.I2C_MSG_READ, read_back)]),
+                     m.ERROR_UNSPECIFIED,
+                     "I2C transfer() to an absent device did not fail")
+    self.assertEqual(read_back, bytearray(2), "I2C transfer() to an absent device read data")
+
+  def test_i2c_transfer_invalid_reg(self):
+    read_back = bytearray(2)
+    self.assertEqual(self.i2c.transfer([(MRAA_MOCK_I2C_ADDR, 0, bytearray([MRAA_MOCK_I2C_DATA_LEN - 1])),
+                                        (MRAA_MOCK_I2C_ADDR, m.I2C_MSG_READ, read_back)]),
+                     m.ERROR_UNSPECIFIED,
+                     "I2C transfer() reading past the last register did not fail")
+
+  def test_i2c_transfer_no_messages(self):
+    self.assertEqual(self.i2c.transfer([]),
+                     m.ERROR_INVALID_PARAMETER,
+                     "I2C transfer() without messages did not fail")
+
+  def test_i2c_transfer_invalid_message(self):
+    self.assertRaises(ValueError, self.i2c.transfer, [(MRAA_MOCK_I2C_ADDR, 0)])
+    self.assertRaises(ValueError, self.i2c.transfer, [(MRAA_MOCK_I2C_ADDR, 0, [0x00])])
+
+if __name__ == "__main__":
+  u.main()
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "mraa/gpio.h"
+#include "gtest/gtest.h"
+
+/* The MOCK board has one gpio, pin 0, each context keeps its own level */
+#define NUM_PINS 4
+
+/* Multi pin gpio writes test fixture */
+class mraa_gpio_multi_unit : public ::testing::Test
+{
+    protected:
+        /* Per-test setup logic if needed */
+        virtual void SetUp()
+        {
+            int pins[NUM_PINS] = { 0, 0, 0, 0 };
+
+            dev = mraa_gpio_init_multi(pins, NUM_PINS);
+            ASSERT_TRUE(dev != NULL);
+            ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_dir(dev, MRAA_GPIO_OUT));
+        }
+
+        /* Per-test tear-down logic if needed */
+        virtual void TearDown()
+        {
+            mraa_gpio_close(dev);
+        }
+
+        /* Levels of the pins as a mask, bit i being pin i */
+        unsigned int levels()
+        {
+            int values[NUM_PINS];
+            unsigned int mask = 0;
+
+            EXPECT_EQ(MRAA_SUCCESS, mraa_gpio_read_multi(dev, values));
+            for (int i = 0; i < NUM_PINS; ++i) {
+                mask |= (values[i] & 1) << i;
+            }
+            return mask;
+        }
+
+        mraa_gpio_context dev;
+};
+
+/* Value i goes to the i-th pin given to mraa_gpio_init_multi() */
+TEST_F(mraa_gpio_multi_unit, test_write_multi)
+{
+    int values[NUM_PINS] = { 1, 0, 1, 1 };
+
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_write_multi(dev, values));
+    ASSERT_EQ(0xDu, levels());
+
+    values[0] = 0;
+    values[1] = 1;
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_write_multi(dev, values));
+    ASSERT_EQ(0xEu, levels());
+}
+
+/* Bit i of the mask selects the i-th pin, the others keep their level */
+TEST_F(mraa_gpio_multi_unit, test_write_mask)
+{
+    int values[NUM_PINS] = { 1, 0, 1, 1 };
+
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_write_multi(dev, values));
+
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_write_mask(dev, 0x2, 0x3));
+    ASSERT_EQ(0xEu, levels());
+
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_write_mask(dev, 0x0, 0x8));
+    ASSERT_EQ(0x6u, levels());
+
+    // Values outside the mask are ignored
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_write_mask(dev, 0xF, 0x1));
+    ASSERT_EQ(0x7u, levels());
+
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_write_mask(dev, 0xF, 0x0));
+    ASSERT_EQ(0x7u, levels());
+}
+
+/* Mask bits past the pins of the context touch nothing */
+TEST_F(mraa_gpio_multi_unit, test_write_mask_beyond_pins)
+{
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_write_mask(dev, ~0ULL, ~0ULL << NUM_PINS));
+    ASSERT_EQ(0x0u, levels());
+
+    ASSERT_EQ(MRAA_ERROR_INVALID_HANDLE, mraa_gpio_write_mask(NULL, 0x1, 0x1));
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "mraa/i2c.h"
+#include "i2c/i2c_poller.h"
+#include "gtest/gtest.h"
+
+#include <string.h>
+#include <unistd.h>
+
+/* The MOCK board has a device at 0x33 on bus 0, with 10 registers of 0xAB */
+#define MOCK_BUS 0
+#define MOCK_ADDR 0x33
+#define MOCK_BYTE 0xAB
+
+/* I2C register poller test fixture */
+class mraa_i2c_poller_unit : public ::testing::Test
+{
+    protected:
+        /* Per-test setup logic if needed */
+        virtual void SetUp()
+        {
+            poller = NULL;
+        }
+
+        /* Per-test tear-down logic if needed */
+        virtual void TearDown()
+        {
+            if (poller != NULL) {
+                mraa_i2c_poller_stop(poller);
+            }
+        }
+
+        /* Wait up to a second for the first read of range idx */
+        mraa_result_t first_read(unsigned int idx, uint8_t* data, mraa_timestamp_t* timestamp)
+        {
+            mraa_result_t ret = MRAA_ERROR_INVALID_RESOURCE;
+
+            for (int i = 0; i < 1000 && ret == MRAA_ERROR_INVALID_RESOURCE; ++i) {
+                ret = mraa_i2c_poller_read(poller, idx, data, timestamp);
+                if (ret == MRAA_ERROR_INVALID_RESOURCE) {
+                    usleep(1000);
+                }
+            }
+            return ret;
+        }
+
+        mraa_i2c_poller poller;
+};
+
+/* Overlapping and touching ranges of a device are read as one block */
+TEST_F(mraa_i2c_poller_unit, test_merge_blocks)
+{
+    const mraa_i2c_poll_desc descs[] = {
+        { MOCK_BUS, MOCK_ADDR, 7, 2, 1000 },
+        { MOCK_BUS, MOCK_ADDR, 0, 2, 1000 },
+        { MOCK_BUS, MOCK_ADDR, 1, 3, 1000 },
+        { MOCK_BUS, MOCK_ADDR, 4, 1, 1000 },
+    };
+    uint8_t data[3];
+    mraa_timestamp_t timestamp;
+
+    poller = mraa_i2c_poller_start(descs, 4, 1000);
+    ASSERT_TRUE(poller != NULL);
+    ASSERT_EQ(MRAA_SUCCESS, first_read(0, data, &timestamp));
+
+    // The next tick is a second away, the blocks of this one stay put
+    struct _i2c_poll_bus* pbus = &poller->buses[0];
+    ASSERT_EQ(1u, poller->num_buses);
+    ASSERT_EQ(0, pbus->blocks[0].reg);
+    ASSERT_EQ(5, pbus->blocks[0].len);
+    ASSERT_EQ(7, pbus->blocks[1].reg);
+    ASSERT_EQ(2, pbus->blocks[1].len);
+
+    for (unsigned int i = 0; i < 4; ++i) {
+        memset(data, 0, sizeof(data));
+        ASSERT_EQ(MRAA_SUCCESS, mraa_i2c_poller_read(poller, i, data, &timestamp));
+        ASSERT_NE(0u, timestamp);
+        for (unsigned int j = 0; j < descs[i].len; ++j) {
+            ASSERT_EQ(MOCK_BYTE, data[j]);
+        }
+    }
+}
+
+/* A device that does not answer fails its own ranges only */
+TEST_F(mraa_i2c_poller_unit, test_failing_device)
+{
+    const mraa_i2c_poll_desc descs[] = {
+        { MOCK_BUS, MOCK_ADDR, 0, 2, 1000 },
+        { MOCK_BUS, MOCK_ADDR + 1, 0, 2, 1000 },
+        { MOCK_BUS, MOCK_ADDR, 6, 4, 1000 },
+    };
+    uint8_t data[4] = { 0 };
+    mraa_timestamp_t timestamp;
+
+    poller = mraa_i2c_poller_start(descs, 3, 1000);
+    ASSERT_TRUE(poller != NULL);
+
+    ASSERT_EQ(MRAA_SUCCESS, first_read(0, data, &timestamp));
+    ASSERT_EQ(MOCK_BYTE, data[0]);
+    ASSERT_EQ(MOCK_BYTE, data[1]);
+
+    ASSERT_EQ(MRAA_SUCCESS, mraa_i2c_poller_read(poller, 2, data, &timestamp));
+    ASSERT_EQ(MOCK_BYTE, data[3]);
+
+    // Failed reads keep the zeroes and timestamp from before the first good read
+    memset(data, 0x55, sizeof(data));
+    ASSERT_NE(MRAA_SUCCESS, mraa_i2c_poller_read(poller, 1, data, &timestamp));
+    ASSERT_EQ(0, data[0]);
+    ASSERT_EQ(0, data[1]);
+    ASSERT_EQ(0u, timestamp);
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "mraa/i2c.h"
+#include "gtest/gtest.h"
+
+#include <pthread.h>
+#include <vector>
+
+/* The MOCK board has a device at 0x33 on bus 0 */
+#define MOCK_BUS 0
+#define MOCK_ADDR 0x33
+
+/* Bookkeeping shared with the job callbacks, which run on the bus worker */
+struct queue_state {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    mraa_i2c_context dev;
+    bool holding;           /**< the first job callback is running */
+    bool released;          /**< the first job callback may return */
+    std::vector<int> order; /**< job ids in completion order */
+    mraa_result_t wait_result;
+    mraa_result_t stop_result;
+};
+
+static queue_state state;
+
+/* I2C job queue test fixture */
+class mraa_i2c_queue_unit : public ::testing::Test
+{
+    protected:
+        /* Per-test setup logic if needed */
+        virtual void SetUp()
+        {
+            pthread_mutex_init(&state.lock, NULL);
+            pthread_cond_init(&state.cond, NULL);
+            state.order.clear();
+            state.holding = false;
+            state.released = false;
+            state.wait_result = MRAA_ERROR_UNSPECIFIED;
+            state.stop_result = MRAA_ERROR_UNSPECIFIED;
+            state.dev = mraa_i2c_init(MOCK_BUS);
+            ASSERT_TRUE(state.dev != NULL);
+            ASSERT_EQ(MRAA_SUCCESS, mraa_i2c_address(state.dev, MOCK_ADDR));
+        }
+
+        /* Per-test tear-down logic if needed */
+        virtual void TearDown()
+        {
+            if (state.dev != NULL) {
+                mraa_i2c_stop(state.dev);
+            }
+            pthread_cond_destroy(&state.cond);
+            pthread_mutex_destroy(&state.lock);
+        }
+
+        /* Queue a one byte register select tagged with id */
+        void submit(int id, int priority, mraa_i2c_job_cb cb)
+        {
+            jobs[id].msgs = &msgs[id];
+            jobs[id].num_msgs = 1;
+            jobs[id].priority = priority;
+            jobs[id].user_data = &ids[id];
+            msgs[id].addr = MOCK_ADDR;
+            msgs[id].flags = 0;
+            msgs[id].len = 1;
+            msgs[id].buf = &regs[id];
+            regs[id] = 0;
+            ids[id] = id;
+            ASSERT_EQ(MRAA_SUCCESS, mraa_i2c_submit(state.dev, &jobs[id], cb));
+        }
+
+        /* Block until the first job callback holds the worker */
+        void wait_holding()
+        {
+            pthread_mutex_lock(&state.lock);
+            while (!state.holding) {
+                pthread_cond_wait(&state.cond, &state.lock);
+            }
+            pthread_mutex_unlock(&state.lock);
+        }
+
+        /* Let the first job callback return */
+        void release()
+        {
+            pthread_mutex_lock(&state.lock);
+            state.released = true;
+            pthread_cond_broadcast(&state.cond);
+            pthread_mutex_unlock(&state.lock);
+        }
+
+        mraa_i2c_job jobs[8];
+        mraa_i2c_msg msgs[8];
+        uint8_t regs[8];
+        int ids[8];
+};
+
+/* Record the completion order of the jobs */
+static void
+record_cb(mraa_i2c_job* job, mraa_result_t result)
+{
+    EXPECT_EQ(MRAA_SUCCESS, result);
+    pthread_mutex_lock(&state.lock);
+    state.order.push_back(*(int*) job->user_data);
+    pthread_mutex_unlock(&state.lock);
+}
+
+/* Keep the worker busy until the test released it */
+static void
+hold_cb(mraa_i2c_job* job, mraa_result_t result)
+{
+    record_cb(job, result);
+    pthread_mutex_lock(&state.lock);
+    state.holding = true;
+    pthread_cond_broadcast(&state.cond);
+    while (!state.released) {
+        pthread_cond_wait(&state.cond, &state.lock);
+    }
+    pthread_mutex_unlock(&state.lock);
+}
+
+/* Try to wait for and stop the context from the worker */
+static void
+reenter_cb(mraa_i2c_job* job, mraa_result_t result)
+{
+    record_cb(job, result);
+    state.wait_result = mraa_i2c_wait_jobs(state.dev);
+    state.stop_result = mraa_i2c_stop(state.dev);
+}
+
+/* Jobs queued behind a busy worker run by priority, then in submission order */
+TEST_F(mraa_i2c_queue_unit, test_priority_order)
+{
+    submit(0, 0, hold_cb);
+    wait_holding();
+
+    submit(1, 0, record_cb);
+    submit(2, 5, record_cb);
+    submit(3, 0, record_cb);
+    submit(4, 5, record_cb);
+    submit(5, -1, record_cb);
+    submit(6, 9, record_cb);
+    ASSERT_EQ(7u, mraa_i2c_queue_depth(state.dev));
+
+    release();
+    ASSERT_EQ(MRAA_SUCCESS, mraa_i2c_wait_jobs(state.dev));
+
+    ASSERT_EQ(std::vector<int>({ 0, 6, 2, 4, 1, 3, 5 }), state.order);
+    ASSERT_EQ(0u, mraa_i2c_queue_depth(state.dev));
+}
+
+/* wait_jobs returns once every callback ran, also with nothing queued */
+TEST_F(mraa_i2c_queue_unit, test_wait_jobs)
+{
+    ASSERT_EQ(MRAA_SUCCESS, mraa_i2c_wait_jobs(state.dev));
+
+    for (int i = 0; i < 8; ++i) {
+        submit(i, i % 3, record_cb);
+    }
+    ASSERT_EQ(MRAA_SUCCESS, mraa_i2c_wait_jobs(state.dev));
+
+    ASSERT_EQ(8u, state.order.size());
+    ASSERT_EQ(0u, mraa_i2c_queue_depth(state.dev));
+    ASSERT_EQ(MRAA_ERROR_INVALID_HANDLE, mraa_i2c_wait_jobs(NULL));
+}
+
+/* Callbacks can neither wait for nor stop their context, which stays usable */
+TEST_F(mraa_i2c_queue_unit, test_refused_from_callback)
+{
+    submit(0, 0, reenter_cb);
+    ASSERT_EQ(MRAA_SUCCESS, mraa_i2c_wait_jobs(state.dev));
+
+    ASSERT_EQ(MRAA_ERROR_INVALID_RESOURCE, state.wait_result);
+    ASSERT_EQ(MRAA_ERROR_INVALID_RESOURCE, state.stop_result);
+
+    submit(1, 0, record_cb);
+    ASSERT_EQ(MRAA_SUCCESS, mraa_i2c_stop(state.dev));
+    state.dev = NULL;
+    ASSERT_EQ(std::vector<int>({ 0, 1 }), state.order);
+}
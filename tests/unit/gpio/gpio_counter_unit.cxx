@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "gtest/gtest.h"
+#include "gpio/gpio_counter.h"
+
+#include <limits.h>
+
+/* 1.6 s window, 100 ms buckets */
+#define WINDOW_MS 1600
+#define BUCKET_NS 100000000ULL
+/* Counting starts on a bucket boundary */
+#define START_NS (100 * BUCKET_NS)
+
+/* GPIO edge counter test fixture */
+class gpio_counter_unit : public ::testing::Test
+{
+    protected:
+        /* Per-test setup logic if needed */
+        virtual void SetUp()
+        {
+            counter = mraa_gpio_counter_new(2, WINDOW_MS);
+            ASSERT_TRUE(counter != NULL);
+            counter->lines[0].start_ns = START_NS;
+            counter->lines[1].start_ns = START_NS;
+        }
+
+        /* Per-test tear-down logic if needed */
+        virtual void TearDown()
+        {
+            mraa_gpio_counter_free(counter);
+        }
+
+        mraa_gpio_counter_t counter;
+};
+
+/* Nothing counted and no time elapsed gives a zero rate, not a division by zero */
+TEST_F(gpio_counter_unit, test_zero_elapsed)
+{
+    mraa_gpio_counter_value value;
+
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_counter_get_at(counter, 0, START_NS, &value));
+    ASSERT_EQ(0u, value.count);
+    ASSERT_EQ(0.0, value.frequency_hz);
+
+    mraa_gpio_counter_edge(counter, 0, START_NS);
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_counter_get_at(counter, 0, START_NS, &value));
+    ASSERT_EQ(1u, value.count);
+    ASSERT_EQ(0.0, value.frequency_hz);
+}
+
+/* Less than a window since start, the rate is over the elapsed time */
+TEST_F(gpio_counter_unit, test_rate_since_start)
+{
+    mraa_gpio_counter_value value;
+
+    for (int i = 0; i < 10; ++i) {
+        mraa_gpio_counter_edge(counter, 0, START_NS + i * BUCKET_NS);
+    }
+
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_counter_get_at(counter, 0, START_NS + 10 * BUCKET_NS, &value));
+    ASSERT_EQ(10u, value.count);
+    ASSERT_DOUBLE_EQ(10.0, value.frequency_hz);
+
+    /* The other line is untouched */
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_counter_get_at(counter, 1, START_NS + 10 * BUCKET_NS, &value));
+    ASSERT_EQ(0u, value.count);
+    ASSERT_EQ(0.0, value.frequency_hz);
+}
+
+/* Past a full window only the edges of the window are rated */
+TEST_F(gpio_counter_unit, test_rate_sliding_window)
+{
+    mraa_gpio_counter_value value;
+
+    /* 2 edges per bucket for 3.15 s */
+    for (int i = 0; i < 32; ++i) {
+        mraa_gpio_counter_edge(counter, 0, START_NS + i * BUCKET_NS);
+        if (i < 31) {
+            mraa_gpio_counter_edge(counter, 0, START_NS + i * BUCKET_NS + BUCKET_NS / 2);
+        }
+    }
+
+    /* Half way through the last bucket: 15 full buckets and half of the current one */
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_counter_get_at(counter, 0, START_NS + 31 * BUCKET_NS + BUCKET_NS / 2, &value));
+    ASSERT_EQ(63u, value.count);
+    ASSERT_DOUBLE_EQ(20.0, value.frequency_hz);
+}
+
+/* A bucket is reused once the ring of buckets wrapped, old edges leave the window */
+TEST_F(gpio_counter_unit, test_bucket_wrap)
+{
+    mraa_gpio_counter_value value;
+
+    for (int i = 0; i < 5; ++i) {
+        mraa_gpio_counter_edge(counter, 0, START_NS);
+    }
+
+    /* One window later the first bucket no longer counts */
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_counter_get_at(counter, 0, START_NS + 16 * BUCKET_NS, &value));
+    ASSERT_EQ(5u, value.count);
+    ASSERT_EQ(0.0, value.frequency_hz);
+
+    /* Same slot, new epoch: it starts over instead of adding up */
+    mraa_gpio_counter_edge(counter, 0, START_NS + 16 * BUCKET_NS);
+    ASSERT_EQ(1u, counter->lines[0].bucket_count[100 % MRAA_GPIO_COUNTER_BUCKETS]);
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_counter_get_at(counter, 0, START_NS + 17 * BUCKET_NS, &value));
+    ASSERT_EQ(6u, value.count);
+    ASSERT_DOUBLE_EQ(1.0 / 1.5, value.frequency_hz);
+}
+
+/* The edge count and the sequence counter wrap around without breaking readers */
+TEST_F(gpio_counter_unit, test_counter_wrap)
+{
+    mraa_gpio_counter_value value;
+
+    counter->lines[0].count = UINT64_MAX;
+    counter->lines[0].seq = UINT_MAX - 1;
+
+    mraa_gpio_counter_edge(counter, 0, START_NS);
+    ASSERT_EQ(0u, counter->lines[0].seq);
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_counter_get_at(counter, 0, START_NS + BUCKET_NS, &value));
+    ASSERT_EQ(0u, value.count);
+    ASSERT_DOUBLE_EQ(10.0, value.frequency_hz);
+
+    mraa_gpio_counter_edge(counter, 0, START_NS);
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_counter_get_at(counter, 0, START_NS + BUCKET_NS, &value));
+    ASSERT_EQ(1u, value.count);
+    ASSERT_DOUBLE_EQ(20.0, value.frequency_hz);
+}
+
+/* Clearing restarts the count, lines beyond the context are rejected */
+TEST_F(gpio_counter_unit, test_clear_and_invalid_line)
+{
+    mraa_gpio_counter_value value;
+
+    mraa_gpio_counter_edge(counter, 1, START_NS);
+    mraa_gpio_counter_clear(counter);
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_counter_get(counter, 1, &value));
+    ASSERT_EQ(0u, value.count);
+
+    ASSERT_EQ(MRAA_ERROR_INVALID_PARAMETER, mraa_gpio_counter_get(counter, 2, &value));
+}
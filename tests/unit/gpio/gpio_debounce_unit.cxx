@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "gtest/gtest.h"
+#include "gpio/gpio_debounce.h"
+
+#include <poll.h>
+
+/* 10ms stable window */
+#define STABLE_NS 10000000ULL
+
+/* GPIO debounce filter test fixture */
+class gpio_debounce_unit : public ::testing::Test
+{
+    protected:
+        /* Per-test setup logic if needed */
+        virtual void SetUp()
+        {
+            debounce = mraa_gpio_debounce_new(2, STABLE_NS / 1000, 0);
+            ASSERT_TRUE(debounce != NULL);
+        }
+
+        /* Per-test tear-down logic if needed */
+        virtual void TearDown()
+        {
+            mraa_gpio_debounce_free(debounce);
+        }
+
+        /* Block until the timer fires for the earliest pending window */
+        bool wait_timer(int timeout_ms)
+        {
+            struct pollfd pfd = { debounce->timer_fd, POLLIN, 0 };
+            return poll(&pfd, 1, timeout_ms) == 1;
+        }
+
+        mraa_gpio_debounce_t debounce;
+        mraa_gpio_debounce_ready ready[2];
+};
+
+/* An edge older than the window is ready at once, the timer is disarmed after */
+TEST_F(gpio_debounce_unit, test_stable_edge)
+{
+    uint64_t then = mraa_monotonic_ns() - 2 * STABLE_NS;
+
+    mraa_gpio_debounce_edge(debounce, 1, 1, then);
+    ASSERT_TRUE(wait_timer(100));
+    ASSERT_EQ(1u, mraa_gpio_debounce_expire(debounce, ready));
+    ASSERT_EQ(1, ready[0].line);
+    ASSERT_EQ(1, ready[0].level);
+    ASSERT_EQ(then, ready[0].since);
+
+    ASSERT_EQ(0u, mraa_gpio_debounce_expire(debounce, ready));
+    ASSERT_FALSE(wait_timer(2 * STABLE_NS / 1000000));
+}
+
+/* A bounce restarts the window, only the level it left is reported */
+TEST_F(gpio_debounce_unit, test_bounce_restarts_window)
+{
+    uint64_t now = mraa_monotonic_ns();
+
+    mraa_gpio_debounce_edge(debounce, 0, 1, now - 2 * STABLE_NS);
+    mraa_gpio_debounce_edge(debounce, 0, 0, now);
+    ASSERT_EQ(0u, mraa_gpio_debounce_expire(debounce, ready));
+
+    ASSERT_TRUE(wait_timer(10 * STABLE_NS / 1000000));
+    ASSERT_GE(mraa_monotonic_ns(), now + STABLE_NS);
+    ASSERT_EQ(1u, mraa_gpio_debounce_expire(debounce, ready));
+    ASSERT_EQ(0, ready[0].line);
+    ASSERT_EQ(0, ready[0].level);
+    ASSERT_EQ(now, ready[0].since);
+}
+
+/* Lines are filtered independently, an edge out of range is ignored */
+TEST_F(gpio_debounce_unit, test_lines_independent)
+{
+    uint64_t now = mraa_monotonic_ns();
+
+    mraa_gpio_debounce_edge(debounce, 0, 1, now - 2 * STABLE_NS);
+    mraa_gpio_debounce_edge(debounce, 1, 1, now);
+    mraa_gpio_debounce_edge(debounce, 2, 1, now - 2 * STABLE_NS);
+    mraa_gpio_debounce_edge(debounce, -1, 1, now - 2 * STABLE_NS);
+
+    ASSERT_EQ(1u, mraa_gpio_debounce_expire(debounce, ready));
+    ASSERT_EQ(0, ready[0].line);
+
+    mraa_gpio_debounce_reset(debounce);
+    ASSERT_EQ(0u, mraa_gpio_debounce_expire(debounce, ready));
+}
+
+/* Commit reports a level once, repeating it is suppressed until it changes */
+TEST_F(gpio_debounce_unit, test_commit_suppresses_repeats)
+{
+    ASSERT_TRUE(mraa_gpio_debounce_commit(debounce, 0, 1));
+    ASSERT_FALSE(mraa_gpio_debounce_commit(debounce, 0, 1));
+    ASSERT_TRUE(mraa_gpio_debounce_commit(debounce, 0, 0));
+    ASSERT_FALSE(mraa_gpio_debounce_commit(debounce, 0, 0));
+
+    // Lines keep their own level
+    ASSERT_TRUE(mraa_gpio_debounce_commit(debounce, 1, 0));
+
+    // After a reset the first level is reported again
+    mraa_gpio_debounce_reset(debounce);
+    ASSERT_TRUE(mraa_gpio_debounce_commit(debounce, 0, 0));
+}
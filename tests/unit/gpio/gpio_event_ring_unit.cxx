@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "gtest/gtest.h"
+#include "gpio/gpio_event_ring.h"
+
+#include <pthread.h>
+
+/* GPIO event ring test fixture */
+class gpio_event_ring_unit : public ::testing::Test
+{
+    protected:
+        /* Per-test setup logic if needed */
+        virtual void SetUp()
+        {
+            ring = mraa_gpio_event_ring_new(4);
+            ASSERT_TRUE(ring != NULL);
+        }
+
+        /* Per-test tear-down logic if needed */
+        virtual void TearDown()
+        {
+            mraa_gpio_event_ring_free(ring);
+        }
+
+        /* Push an event tagged with its sequence number */
+        int push(unsigned int seqno)
+        {
+            mraa_gpio_capture_event event = {};
+            event.pin = 1;
+            event.edge = MRAA_GPIO_EDGE_RISING;
+            event.timestamp = 1000 * seqno;
+            event.seqno = seqno;
+            return mraa_gpio_event_ring_push(ring, &event);
+        }
+
+        mraa_gpio_event_ring_t ring;
+};
+
+/* Sizes must be a power of two */
+TEST_F(gpio_event_ring_unit, test_size_power_of_two)
+{
+    ASSERT_TRUE(mraa_gpio_event_ring_new(0) == NULL);
+    ASSERT_TRUE(mraa_gpio_event_ring_new(6) == NULL);
+
+    mraa_gpio_event_ring_t other = mraa_gpio_event_ring_new(1);
+    ASSERT_TRUE(other != NULL);
+    mraa_gpio_event_ring_free(other);
+}
+
+/* An empty ring pops nothing and does not block without a timeout */
+TEST_F(gpio_event_ring_unit, test_empty)
+{
+    mraa_gpio_capture_event buf[4];
+
+    ASSERT_EQ(0u, mraa_gpio_event_ring_pop(ring, buf, 4));
+    ASSERT_EQ(0, mraa_gpio_event_ring_wait(ring, buf, 4, 0));
+    ASSERT_EQ(0, mraa_gpio_event_ring_wait(ring, buf, 4, 10));
+    ASSERT_EQ(0u, mraa_gpio_event_ring_dropped(ring));
+}
+
+/* Pushing past capacity keeps the oldest events and counts the rest */
+TEST_F(gpio_event_ring_unit, test_full_drops_newest)
+{
+    mraa_gpio_capture_event buf[8];
+
+    for (unsigned int i = 0; i < 4; ++i) {
+        ASSERT_EQ(0, push(i));
+    }
+    ASSERT_EQ(-1, push(4));
+    ASSERT_EQ(-1, push(5));
+    ASSERT_EQ(2u, mraa_gpio_event_ring_dropped(ring));
+
+    ASSERT_EQ(4u, mraa_gpio_event_ring_pop(ring, buf, 8));
+    for (unsigned int i = 0; i < 4; ++i) {
+        ASSERT_EQ(i, buf[i].seqno);
+        ASSERT_EQ(1000ULL * i, buf[i].timestamp);
+    }
+
+    /* Room again once drained */
+    ASSERT_EQ(0, push(6));
+    ASSERT_EQ(2u, mraa_gpio_event_ring_dropped(ring));
+
+    mraa_gpio_event_ring_add_dropped(ring, 3);
+    ASSERT_EQ(5u, mraa_gpio_event_ring_dropped(ring));
+}
+
+/* Partial pops and pushes wrap around the slots in order */
+TEST_F(gpio_event_ring_unit, test_wraparound)
+{
+    mraa_gpio_capture_event buf[4];
+    unsigned int next_push = 0, next_pop = 0;
+
+    for (int round = 0; round < 10; ++round) {
+        while (push(next_push) == 0) {
+            next_push++;
+        }
+
+        unsigned int count = mraa_gpio_event_ring_pop(ring, buf, 3);
+        ASSERT_EQ(3u, count);
+        for (unsigned int i = 0; i < count; ++i) {
+            ASSERT_EQ(next_pop++, buf[i].seqno);
+        }
+    }
+
+    ASSERT_EQ(1u, mraa_gpio_event_ring_pop(ring, buf, 4));
+    ASSERT_EQ(next_pop, buf[0].seqno);
+    ASSERT_EQ(next_push, next_pop + 1);
+    ASSERT_EQ(10u, mraa_gpio_event_ring_dropped(ring));
+}
+
+/* A notified wait returns what was queued */
+TEST_F(gpio_event_ring_unit, test_wait_notified)
+{
+    mraa_gpio_capture_event buf[4];
+
+    ASSERT_EQ(0, push(7));
+    mraa_gpio_event_ring_notify(ring);
+
+    ASSERT_EQ(1, mraa_gpio_event_ring_wait(ring, buf, 4, 100));
+    ASSERT_EQ(7u, buf[0].seqno);
+
+    /* The stale wakeup is consumed without returning anything */
+    mraa_gpio_event_ring_notify(ring);
+    ASSERT_EQ(0, mraa_gpio_event_ring_wait(ring, buf, 4, 10));
+}
+
+/* Reader blocked until its ring is closed */
+static void*
+blocked_reader(void* arg)
+{
+    mraa_gpio_event_ring_t* slot = (mraa_gpio_event_ring_t*) arg;
+    mraa_gpio_capture_event buf[4];
+    long ret = -2;
+
+    mraa_gpio_event_ring_t ring = mraa_gpio_event_ring_enter(slot);
+    if (ring != NULL) {
+        ret = mraa_gpio_event_ring_wait(ring, buf, 4, -1);
+        mraa_gpio_event_ring_leave(ring);
+    }
+
+    return (void*) ret;
+}
+
+/* Closing wakes every blocked reader and waits for them before freeing */
+TEST_F(gpio_event_ring_unit, test_close_wakes_readers)
+{
+    pthread_t readers[3];
+    void* ret;
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(0, pthread_create(&readers[i], NULL, blocked_reader, &ring));
+    }
+    while (__atomic_load_n(&ring->readers, __ATOMIC_RELAXED) < 3) {
+        sched_yield();
+    }
+
+    mraa_gpio_event_ring_close(&ring);
+    ASSERT_TRUE(ring == NULL);
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(0, pthread_join(readers[i], &ret));
+        ASSERT_EQ(-1L, (long) ret);
+    }
+
+    /* Late readers find nothing to wait on */
+    ASSERT_TRUE(mraa_gpio_event_ring_enter(&ring) == NULL);
+}
+
+#define CONSUMED_EVENTS 20000
+
+/* Counts how often each seqno was read, until the producer is done and the ring empty */
+struct consumer_state {
+    mraa_gpio_event_ring_t ring;
+    unsigned int seen[CONSUMED_EVENTS];
+    int done;
+};
+
+static void*
+consumer(void* arg)
+{
+    consumer_state* state = (consumer_state*) arg;
+    mraa_gpio_capture_event buf[3];
+
+    for (;;) {
+        int done = __atomic_load_n(&state->done, __ATOMIC_ACQUIRE);
+        int count = mraa_gpio_event_ring_wait(state->ring, buf, 3, 10);
+
+        if (count < 0 || (count == 0 && done)) {
+            break;
+        }
+        for (int i = 0; i < count; ++i) {
+            __atomic_fetch_add(&state->seen[buf[i].seqno], 1, __ATOMIC_RELAXED);
+        }
+    }
+
+    return NULL;
+}
+
+/* Concurrent readers share the events, each one is read exactly once */
+TEST_F(gpio_event_ring_unit, test_concurrent_consumers)
+{
+    consumer_state* state = new consumer_state();
+    pthread_t consumers[3];
+
+    state->ring = ring;
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(0, pthread_create(&consumers[i], NULL, consumer, state));
+    }
+
+    for (unsigned int seqno = 0; seqno < CONSUMED_EVENTS; ++seqno) {
+        while (push(seqno) != 0) {
+            sched_yield();
+        }
+        mraa_gpio_event_ring_notify(ring);
+    }
+    __atomic_store_n(&state->done, 1, __ATOMIC_RELEASE);
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(0, pthread_join(consumers[i], NULL));
+    }
+    for (unsigned int seqno = 0; seqno < CONSUMED_EVENTS; ++seqno) {
+        ASSERT_EQ(1u, state->seen[seqno]) << "seqno " << seqno;
+    }
+    delete state;
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "gtest/gtest.h"
+#include "gpio/gpio_mux.h"
+
+#include <string.h>
+
+/* GPIO mux plan test fixture */
+class gpio_mux_unit : public ::testing::Test
+{
+    protected:
+        /* Per-test setup logic if needed */
+        virtual void SetUp()
+        {
+            memset(&meta, 0, sizeof(meta));
+        }
+
+        /* Per-test tear-down logic if needed */
+        virtual void TearDown()
+        {
+            mraa_gpio_mux_cleanup();
+        }
+
+        /* Append a mux command to meta */
+        void mux(unsigned int pincmd, unsigned int pin, unsigned int value)
+        {
+            meta.mux[meta.mux_total].pincmd = pincmd;
+            meta.mux[meta.mux_total].pin = pin;
+            meta.mux[meta.mux_total].value = value;
+            meta.mux_total++;
+        }
+
+        /* Check step i of plan */
+        void expect_step(mraa_gpio_mux_plan_t plan, unsigned int i, unsigned int pin, mraa_mux_op_t op, unsigned int value)
+        {
+            EXPECT_EQ(pin, plan->steps[i].pin);
+            EXPECT_EQ(op, plan->steps[i].op);
+            EXPECT_EQ(value, plan->steps[i].value);
+        }
+
+        mraa_pin_t meta;
+};
+
+/* A command repeated back to back runs once */
+TEST_F(gpio_mux_unit, test_dedup)
+{
+    mux(PINCMD_SET_DIRECTION, 5, MRAA_GPIO_IN);
+    mux(PINCMD_SET_DIRECTION, 5, MRAA_GPIO_IN);
+    mux(PINCMD_SET_VALUE, 6, 1);
+    mux(PINCMD_SET_VALUE, 6, 1);
+    mux(PINCMD_SET_VALUE, 6, 0);
+
+    mraa_gpio_mux_plan_t plan = mraa_gpio_mux_plan_get(&meta);
+    ASSERT_TRUE(plan != NULL);
+    ASSERT_EQ(3u, plan->num_steps);
+    expect_step(plan, 0, 5, MRAA_MUX_OP_DIR, MRAA_GPIO_IN);
+    expect_step(plan, 1, 6, MRAA_MUX_OP_WRITE, 1);
+    expect_step(plan, 2, 6, MRAA_MUX_OP_WRITE, 0);
+}
+
+/* DIR OUT then a level on the same pin is one OUT_HIGH / OUT_LOW write */
+TEST_F(gpio_mux_unit, test_merge_out)
+{
+    mux(PINCMD_SET_DIRECTION, 7, MRAA_GPIO_OUT);
+    mux(PINCMD_SET_VALUE, 7, 1);
+    mux(PINCMD_SET_DIRECTION, 8, MRAA_GPIO_OUT);
+    mux(PINCMD_SET_VALUE, 8, 0);
+
+    mraa_gpio_mux_plan_t plan = mraa_gpio_mux_plan_get(&meta);
+    ASSERT_TRUE(plan != NULL);
+    ASSERT_EQ(2u, plan->num_steps);
+    expect_step(plan, 0, 7, MRAA_MUX_OP_OUT, 1);
+    expect_step(plan, 1, 8, MRAA_MUX_OP_OUT, 0);
+}
+
+/* Only DIR OUT merges, and only with a level on the same pin */
+TEST_F(gpio_mux_unit, test_merge_out_only)
+{
+    mux(PINCMD_SET_DIRECTION, 7, MRAA_GPIO_IN);
+    mux(PINCMD_SET_VALUE, 7, 1);
+    mux(PINCMD_SET_DIRECTION, 8, MRAA_GPIO_OUT);
+    mux(PINCMD_SET_VALUE, 9, 1);
+
+    mraa_gpio_mux_plan_t plan = mraa_gpio_mux_plan_get(&meta);
+    ASSERT_TRUE(plan != NULL);
+    ASSERT_EQ(4u, plan->num_steps);
+    expect_step(plan, 0, 7, MRAA_MUX_OP_DIR, MRAA_GPIO_IN);
+    expect_step(plan, 1, 7, MRAA_MUX_OP_WRITE, 1);
+    expect_step(plan, 2, 8, MRAA_MUX_OP_DIR, MRAA_GPIO_OUT);
+    expect_step(plan, 3, 9, MRAA_MUX_OP_WRITE, 1);
+}
+
+/* PINCMD_SKIP leaves no step, nor does it keep its neighbours apart */
+TEST_F(gpio_mux_unit, test_skip_dropped)
+{
+    mux(PINCMD_SET_VALUE, 3, 1);
+    mux(PINCMD_SKIP, 9, 1);
+    mux(PINCMD_SET_VALUE, 3, 1);
+    mux(PINCMD_SET_DIRECTION, 4, MRAA_GPIO_OUT);
+    mux(PINCMD_SKIP, 4, 0);
+    mux(PINCMD_SET_VALUE, 4, 1);
+
+    mraa_gpio_mux_plan_t plan = mraa_gpio_mux_plan_get(&meta);
+    ASSERT_TRUE(plan != NULL);
+    ASSERT_EQ(2u, plan->num_steps);
+    expect_step(plan, 0, 3, MRAA_MUX_OP_WRITE, 1);
+    expect_step(plan, 1, 4, MRAA_MUX_OP_OUT, 1);
+}
+
+/* The remaining commands map one to one */
+TEST_F(gpio_mux_unit, test_ops)
+{
+    mux(PINCMD_UNDEFINED, 1, 1);
+    mux(PINCMD_SET_IN_VALUE, 2, 0);
+    mux(PINCMD_SET_OUT_VALUE, 3, 1);
+    mux(PINCMD_SET_MODE, 4, MRAA_GPIO_PULLUP);
+
+    mraa_gpio_mux_plan_t plan = mraa_gpio_mux_plan_get(&meta);
+    ASSERT_TRUE(plan != NULL);
+    ASSERT_EQ(4u, plan->num_steps);
+    expect_step(plan, 0, 1, MRAA_MUX_OP_OUT_LEGACY, 1);
+    expect_step(plan, 1, 2, MRAA_MUX_OP_IN_VALUE, 0);
+    expect_step(plan, 2, 3, MRAA_MUX_OP_OUT, 1);
+    expect_step(plan, 3, 4, MRAA_MUX_OP_MODE, MRAA_GPIO_PULLUP);
+}
+
+/* Plans are compiled once per mux list */
+TEST_F(gpio_mux_unit, test_cache)
+{
+    mux(PINCMD_SET_VALUE, 3, 1);
+    mraa_gpio_mux_plan_t plan = mraa_gpio_mux_plan_get(&meta);
+    ASSERT_TRUE(plan != NULL);
+    ASSERT_EQ(plan, mraa_gpio_mux_plan_get(&meta));
+
+    meta.mux[0].value = 0;
+    mraa_gpio_mux_plan_t other = mraa_gpio_mux_plan_get(&meta);
+    ASSERT_TRUE(other != NULL);
+    ASSERT_NE(plan, other);
+    expect_step(other, 0, 3, MRAA_MUX_OP_WRITE, 0);
+
+    meta.mux_total = 7;
+    ASSERT_TRUE(mraa_gpio_mux_plan_get(&meta) == NULL);
+}
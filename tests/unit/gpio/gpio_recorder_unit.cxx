@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "gtest/gtest.h"
+#include "gpio/gpio_recorder.h"
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+
+/* GPIO edge recorder test fixture */
+class gpio_recorder_unit : public ::testing::Test
+{
+    protected:
+        /* Per-test setup logic if needed */
+        virtual void SetUp()
+        {
+            int fd = mkstemp(path);
+            ASSERT_TRUE(fd >= 0);
+            close(fd);
+        }
+
+        /* Per-test tear-down logic if needed */
+        virtual void TearDown()
+        {
+            unlink(path);
+        }
+
+        /* Run the VCD export of path, return what it printed */
+        std::string vcd(mraa_result_t expected = MRAA_SUCCESS)
+        {
+            std::string text;
+            char buf[256];
+            size_t len;
+            FILE* out = tmpfile();
+
+            EXPECT_TRUE(out != NULL);
+            EXPECT_EQ(expected, mraa_gpio_record_vcd(path, out));
+            rewind(out);
+            while ((len = fread(buf, 1, sizeof(buf), out)) > 0) {
+                text.append(buf, len);
+            }
+            fclose(out);
+            return text;
+        }
+
+        char path[32] = "/tmp/mraa_recorder_XXXXXX";
+};
+
+/* Small records keep the layout documented for mraa_gpio_record_header */
+TEST_F(gpio_recorder_unit, test_encode_layout)
+{
+    uint8_t record[MRAA_GPIO_RECORD_MAX_LEN];
+
+    ASSERT_EQ(1u, mraa_gpio_recorder_encode(0, 0, 1, record));
+    ASSERT_EQ(0x01, record[0]);
+
+    // (zigzag(1) << 7) | (2 << 1) | 0 = 0x104
+    ASSERT_EQ(2u, mraa_gpio_recorder_encode(1, 2, 0, record));
+    ASSERT_EQ(0x84, record[0]);
+    ASSERT_EQ(0x02, record[1]);
+
+    // (zigzag(-1) << 7) | (63 << 1) | 1 = 0xff
+    ASSERT_EQ(2u, mraa_gpio_recorder_encode(-1, 63, 1, record));
+    ASSERT_EQ(0xff, record[0]);
+    ASSERT_EQ(0x01, record[1]);
+}
+
+/* Every delta decodes back, including the ones past 2^56 that need 11 bytes */
+TEST_F(gpio_recorder_unit, test_round_trip)
+{
+    const int64_t deltas[] = { 0, 1, -1, 63, -64, 127, -128, 1000000000LL, -1000000000LL,
+                               1LL << 56, -(1LL << 56), 1LL << 62, LLONG_MAX - 1, LLONG_MAX,
+                               LLONG_MIN + 1, LLONG_MIN };
+    uint8_t record[MRAA_GPIO_RECORD_MAX_LEN];
+    uint8_t ring[16];
+
+    for (int64_t delta : deltas) {
+        for (int idx : { 0, 1, 63 }) {
+            for (int level : { 0, 1 }) {
+                unsigned int len = mraa_gpio_recorder_encode(delta, idx, level, record);
+                int64_t got_delta;
+                int got_idx, got_level;
+
+                ASSERT_GE(len, 1u);
+                ASSERT_LE(len, (unsigned int) MRAA_GPIO_RECORD_MAX_LEN);
+
+                // Written across the end of the ring, like the recorder does
+                for (unsigned int i = 0; i < len; ++i) {
+                    ring[(10 + i) % sizeof(ring)] = record[i];
+                }
+                ASSERT_EQ(len, mraa_gpio_recorder_decode(ring, sizeof(ring), 10, &got_delta, &got_idx, &got_level));
+                ASSERT_EQ(delta, got_delta);
+                ASSERT_EQ(idx, got_idx);
+                ASSERT_EQ(level, got_level);
+            }
+        }
+    }
+
+    ASSERT_EQ((unsigned int) MRAA_GPIO_RECORD_MAX_LEN, mraa_gpio_recorder_encode(LLONG_MIN, 0, 0, record));
+}
+
+/* A varint running past the longest record is refused */
+TEST_F(gpio_recorder_unit, test_decode_malformed)
+{
+    uint8_t ring[MRAA_GPIO_RECORD_MAX_LEN + 1];
+    int64_t delta;
+    int idx, level;
+
+    for (unsigned int i = 0; i < sizeof(ring); ++i) {
+        ring[i] = 0xff;
+    }
+    ASSERT_EQ(0u, mraa_gpio_recorder_decode(ring, sizeof(ring), 0, &delta, &idx, &level));
+}
+
+/* A full ring forgets its oldest edges into the tail state */
+TEST_F(gpio_recorder_unit, test_overwrite_folds_tail)
+{
+    const int pins[] = { 4 };
+    mraa_gpio_record_header header;
+
+    mraa_gpio_recorder_t recorder = mraa_gpio_recorder_new(path, 8, pins, 1, 0, 1000);
+    ASSERT_TRUE(recorder != NULL);
+
+    // 2 bytes each, the fifth does not fit beside the first four
+    for (int i = 1; i <= 5; ++i) {
+        mraa_gpio_recorder_edge(recorder, 0, i & 1, 1000 + 10 * i);
+    }
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_recorder_close(recorder, &header));
+
+    ASSERT_EQ(5u, header.events);
+    ASSERT_EQ(1u, header.overwritten);
+    ASSERT_EQ(10u, header.head);
+    ASSERT_EQ(2u, header.tail);
+    ASSERT_EQ(1010u, header.tail_timestamp);
+    ASSERT_EQ(1u, header.tail_levels);
+
+    ASSERT_EQ("$timescale 1ns $end\n$scope module mraa $end\n"
+              "$var wire 1 ! pin4 $end\n"
+              "$upscope $end\n$enddefinitions $end\n#0\n$dumpvars\n"
+              "1!\n"
+              "$end\n"
+              "#10\n0!\n#20\n1!\n#30\n0!\n#40\n1!\n",
+              vcd());
+}
+
+/* Header, initial levels, then edges; time never steps back in the dump */
+TEST_F(gpio_recorder_unit, test_vcd)
+{
+    const int pins[] = { 3, 7 };
+
+    mraa_gpio_recorder_t recorder = mraa_gpio_recorder_new(path, 64, pins, 2, 0x2, 5000);
+    ASSERT_TRUE(recorder != NULL);
+
+    mraa_gpio_recorder_edge(recorder, 0, 1, 5100);
+    mraa_gpio_recorder_edge(recorder, 1, 0, 5100);
+    mraa_gpio_recorder_edge(recorder, 0, 0, 5050);
+    mraa_gpio_recorder_edge(recorder, 1, 1, 6000);
+    ASSERT_EQ(MRAA_SUCCESS, mraa_gpio_recorder_close(recorder, NULL));
+
+    ASSERT_EQ("$timescale 1ns $end\n$scope module mraa $end\n"
+              "$var wire 1 ! pin3 $end\n"
+              "$var wire 1 \" pin7 $end\n"
+              "$upscope $end\n$enddefinitions $end\n#0\n$dumpvars\n"
+              "0!\n1\"\n"
+              "$end\n"
+              "#100\n1!\n0\"\n0!\n#1000\n1\"\n",
+              vcd());
+}
+
+/* Anything but a recording is refused */
+TEST_F(gpio_recorder_unit, test_vcd_invalid)
+{
+    FILE* fp = fopen(path, "wb");
+    ASSERT_TRUE(fp != NULL);
+    fputs("not a recording", fp);
+    fclose(fp);
+
+    ASSERT_EQ("", vcd(MRAA_ERROR_INVALID_RESOURCE));
+    ASSERT_EQ(MRAA_ERROR_INVALID_PARAMETER, mraa_gpio_record_vcd(NULL, stdout));
+    ASSERT_EQ(MRAA_ERROR_INVALID_PARAMETER, mraa_gpio_record_vcd(path, NULL));
+}
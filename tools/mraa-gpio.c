@@ -12,6 +12,8 @@
 
 #include "mraa/gpio.h"
 
+#define CAPTURE_RING_SIZE (4 * 1024 * 1024)
+
 struct gpio_source {
     int pin;
     mraa_gpio_context context;
@@ -32,6 +34,10 @@ print_help()
     fprintf(stdout, "get pin           Get pin level\n");
     fprintf(stdout, "getraw pin        Get pin level via mmap (if available)\n");
     fprintf(stdout, "monitor pin       Monitor pin level changes\n");
+    fprintf(stdout, "capture file secs pin [pin...]\n");
+    fprintf(stdout, "                  Record edges of up to 64 pins to file for secs seconds,\n");
+    fprintf(stdout, "                  0 stops on RETURN\n");
+    fprintf(stdout, "vcd file          Print a capture file as VCD\n");
     fprintf(stdout, "version           Get mraa version and board name\n");
 }
 
@@ -159,6 +165,58 @@ gpio_isr_stop(struct gpio_source* gpio_info)
 }
 
 
+void
+wait_return()
+{
+    char aux = 0;
+    do {
+        fflush(stdin);
+        fscanf(stdin, "%c", &aux);
+    } while (aux != '\n');
+}
+
+mraa_result_t
+gpio_capture(const char* path, int secs, int pins[], int num_pins)
+{
+    mraa_gpio_record_header header;
+    mraa_gpio_context gpio = mraa_gpio_init_multi(pins, num_pins);
+    if (gpio == NULL) {
+        return MRAA_ERROR_INVALID_RESOURCE;
+    }
+
+    mraa_result_t status = mraa_gpio_dir(gpio, MRAA_GPIO_IN);
+    if (status == MRAA_SUCCESS) {
+        status = mraa_gpio_record_start(gpio, path, CAPTURE_RING_SIZE, MRAA_GPIO_EDGE_BOTH);
+    }
+    if (status != MRAA_SUCCESS) {
+        mraa_gpio_close(gpio);
+        return status;
+    }
+
+    if (secs > 0) {
+        fprintf(stdout, "Capturing to %s for %d s\n", path, secs);
+        sleep(secs);
+    } else {
+        fprintf(stdout, "Capturing to %s. Press RETURN to stop.\n", path);
+        wait_return();
+    }
+
+    status = mraa_gpio_record_stop(gpio, &header);
+    if (status == MRAA_SUCCESS) {
+        fprintf(stdout, "%llu edges, %llu overwritten, %llu dropped\n", (unsigned long long) header.events,
+                (unsigned long long) header.overwritten, (unsigned long long) header.dropped);
+    }
+    mraa_gpio_close(gpio);
+
+    return status;
+}
+
+int
+gpio_vcd(const char* path)
+{
+    return mraa_gpio_record_vcd(path, stdout) == MRAA_SUCCESS ? 0 : -1;
+}
+
 int
 main(int argc, char** argv)
 {
@@ -203,11 +261,7 @@ main(int argc, char** argv)
                 if (gpio_isr_start(&gpio_info) == MRAA_SUCCESS) {
                     fprintf(stdout, "Monitoring level changes to pin %d. Press RETURN to exit.\n", pin);
                     gpio_isr_handler(&gpio_info);
-                    char aux = 0;
-                    do {
-                        fflush(stdin);
-                        fscanf(stdin, "%c", &aux);
-                    } while (aux != '\n');
+                    wait_return();
                     gpio_isr_stop(&gpio_info);
                 } else {
                     fprintf(stdout, "Failed to register ISR for pin %d\n", pin);
@@ -215,6 +269,27 @@ main(int argc, char** argv)
             } else {
                 print_command_error();
             }
+        } else if (strcmp(argv[1], "capture") == 0) {
+            if (argc >= 5 && argc <= 4 + 64) {
+                int num_pins = argc - 4;
+                int pins[64];
+                for (int i = 0; i < num_pins; ++i) {
+                    pins[i] = atoi(argv[4 + i]);
+                }
+                if (gpio_capture(argv[2], atoi(argv[3]), pins, num_pins) != MRAA_SUCCESS) {
+                    fprintf(stdout, "Failed to capture to %s\n", argv[2]);
+                }
+            } else {
+                print_command_error();
+            }
+        } else if (strcmp(argv[1], "vcd") == 0) {
+            if (argc == 3) {
+                if (gpio_vcd(argv[2]) != 0) {
+                    fprintf(stderr, "Could not read capture file %s\n", argv[2]);
+                }
+            } else {
+                print_command_error();
+            }
         } else {
             print_command_error();
         }